@@ -1,34 +1,57 @@
-typedef struct tree
+#include "tokval.h"
+#include "lexer.h"
+/* node kinds; sym.y's nodename[] holds the label printed for each */
+typedef enum nodekind
 {
-	char *opr;
-	char *value;
-	struct tree* c1;
-	struct tree* c2;
-    struct tree* c3;
-    struct tree* c4;
-}TREE;
+	N_CLASS_DECL, N_METHOD_DECL, N_MODIFIER, N_ACCESS_MODIFIER, N_CLASSNAME,
+	N_BLOCK, N_STMT, N_ASSIGN_STMT, N_VAR_DECL_STMT, N_ARRAY_DECL_STMT,
+	N_ARRAY_INIT_STMT, N_IF, N_IF_ELSE, N_ELSE, N_FOR, N_FOR_COND,
+	N_UNARY, N_INCREMENT, N_VAR_DECL, N_VAR_INIT, N_DECL_CONT, N_ID_LIST,
+	N_COMMA, N_ARRAY_DECL, N_BRACKET, N_NEW, N_DATATYPE, N_NUM, N_ID,
+	N_OP,			/* an operator; val is its spelling, printed as the label */
+	N_LAST = N_OP
+}NODEKIND;
+/*
+	The tree is a set of parallel arrays indexed by node id; id 0 is "no
+	node". A node's children are nkids[id] ids stored together in kids[],
+	starting at first[id]. Trailing missing children are not stored; one
+	in the middle is kept as a 0 so the printer can tell where it was.
+	A block (N_BLOCK) has one child per statement, so the depth of the
+	tree follows the nesting of the program, not its length.
+*/
+typedef unsigned NODEID;
 typedef struct ast
 {
-	TREE* root;
+	NODEID root;
+	unsigned n;				/* nodes, counting node 0 */
+	unsigned cap;
+	unsigned char *kind;	/* NODEKIND */
+	unsigned *nkids;
+	int *val;				/* interned spelling of a leaf's or operator's token, else 0 */
+	unsigned *loc;			/* byte offset of the first token */
+	unsigned *first;		/* index of the first child in kids[] */
+	NODEID *kids;
+	unsigned nkid;
+	unsigned kidcap;
 }AST;
 
-typedef struct yacc
+/*
+	Everything one parse reads and builds. The parser is pure and gets
+	its COMPILATION from yyparse()'s arguments, so several can be parsed
+	at once on different threads.
+*/
+typedef struct compilation
 {
-    char* tr;
-    char* fal;
-    char* next;
-    int i;
-    float f;
-    char* v;
-    char* a;
-    char* code;
-    char* addr;
-    int scope;
-    int occur;
-    char *type;
-    char* val;
-    TREE *ptr;
-}YACC;
+	LEXER lex;
+	AST ast;
+	NODEID *stmts;		/* statements of the open blocks, see pushStmt() */
+	unsigned nstmt;
+	unsigned stmtcap;
+	FILE *out;			/* AST.txt */
+	int showloc;		/* --locations */
+	int rd;				/* --rd: parse with rdParse() (rdparse.c) instead of yyparse() */
+	int errors;
+}COMPILATION;
 
 typedef struct NODE
 {
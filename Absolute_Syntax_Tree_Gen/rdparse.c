@@ -0,0 +1,603 @@
+/*
+	Hand-written recursive-descent parser for the AST phase.
+	It accepts the same language as sym.y and builds the same tree
+	through sym.y's newnode(), newleaf(), opnode(), pushStmt() and
+	block(), node for node, so AST.txt and --stats do not change. One
+	function per nonterminal; binary operators are parsed by precedence
+	climbing with the levels of sym.y's %left lines.
+
+	Tokens come from yylex() through a ring of RD_RING slots. Most
+	decisions need only the current token. Two need the one after it:
+	whether ", x" in a declaration starts an assignment, and whether a
+	bracket group is empty.
+
+	A syntax error is reported with its line and column, what was
+	expected and what was found. The parser then skips to the end of the
+	statement (the next ';' or the '}' closing a block it skipped into)
+	and goes on, so one run lists every independent error. A statement
+	list longjmps to its own recovery point, so correct code pays one
+	sigsetjmp per statement and no error checks. There is no recovery
+	outside a method body; an error there, or at the end of the input,
+	ends the parse.
+
+	Build it with the bison parser, which still holds the tree builders
+	and printAST(), and select it with --rd:
+		yacc -vd sym.y
+		gcc -I. -I../Lexer -pthread ../Lexer/hlex.c y.tab.c rdparse.c
+		./a.out a.java --rd
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "header.c"
+#include "y.tab.h"
+
+NODEID newnode(COMPILATION *cc,int,NODEID,NODEID,NODEID,NODEID);
+NODEID newleaf(COMPILATION *cc,int,int,unsigned);
+NODEID opnode(COMPILATION *cc,int,NODEID,NODEID,NODEID);
+void pushStmt(COMPILATION *cc, NODEID stmt);
+NODEID block(COMPILATION *cc, unsigned mark);
+NODEID child(AST *ast, NODEID node, unsigned i);
+unsigned offsetLine(LINETAB *lt, unsigned off, unsigned *col);
+
+#define RD_RING 4			/* tokens of lookahead kept; a power of two */
+#define RD_MAXERRORS 20
+#define RD_MAXDEPTH 10000	/* nested parentheses and blocks, like bison's YYMAXDEPTH */
+
+typedef struct rdtoken
+{
+	int code;
+	TOKVAL tok;
+}RDTOKEN;
+
+typedef struct rdparser
+{
+	COMPILATION *cc;
+	RDTOKEN ring[RD_RING];
+	unsigned head;			/* slot of the current token */
+	unsigned n;				/* tokens read ahead, the current one included */
+	int eof;				/* yylex() has returned 0 */
+	unsigned lastloc;		/* offset of the last real token, for errors at the end */
+	unsigned depth;			/* open parentheses and blocks */
+	sigjmp_buf *recover;	/* innermost statement list */
+	sigjmp_buf *top;		/* rdParse() itself: give up */
+}RDPARSER;
+
+/* reads one more token into the ring; after the end, every slot reads as 0 */
+static void fill(RDPARSER *p)
+{
+	RDTOKEN *t = &p->ring[(p->head + p->n) & (RD_RING-1)];
+	YYSTYPE v;
+	if(p->eof)
+		t->code = 0;
+	else if((t->code = yylex(&v, &p->cc->lex)) == 0)
+		p->eof = 1;
+	else
+	{
+		t->tok = v.tok;
+		p->lastloc = v.tok.loc;
+	}
+	if(t->code == 0)
+	{
+		t->tok.v = NULL;
+		t->tok.id = 0;
+		t->tok.loc = p->lastloc;
+	}
+	p->n++;
+}
+
+/* the k'th token from the current one */
+static inline RDTOKEN* peek(RDPARSER *p, unsigned k)
+{
+	while(p->n <= k)
+		fill(p);
+	return &p->ring[(p->head + k) & (RD_RING-1)];
+}
+
+static inline int look(RDPARSER *p)
+{
+	return peek(p, 0)->code;
+}
+
+static inline TOKVAL next(RDPARSER *p)
+{
+	TOKVAL t = peek(p, 0)->tok;
+	p->head++;
+	p->n--;
+	return t;
+}
+
+static void syntaxError(RDPARSER *p, const char *what)
+{
+	RDTOKEN *t = peek(p, 0);
+	unsigned col, line = offsetLine(&p->cc->lex.lines, t->tok.loc, &col);
+	if(t->code == 0)
+		fprintf(stderr, "%u:%u: syntax error: expected %s, found end of input\n", line, col, what);
+	else
+		fprintf(stderr, "%u:%u: syntax error: expected %s, found '%s'\n", line, col, what, t->tok.v);
+	if(++p->cc->errors >= RD_MAXERRORS || t->code == 0 || p->recover == NULL)
+		siglongjmp(*p->top, 1);
+	siglongjmp(*p->recover, 1);
+}
+
+/* enters one more level of nesting; too deep ends the parse rather than the stack */
+static void nest(RDPARSER *p)
+{
+	unsigned col, line;
+	if(++p->depth <= RD_MAXDEPTH)
+		return;
+	line = offsetLine(&p->cc->lex.lines, peek(p, 0)->tok.loc, &col);
+	fprintf(stderr, "%u:%u: nested deeper than %d\n", line, col, RD_MAXDEPTH);
+	p->cc->errors++;
+	siglongjmp(*p->top, 1);
+}
+
+static inline TOKVAL expect(RDPARSER *p, int code, const char *what)
+{
+	if(look(p) != code)
+		syntaxError(p, what);
+	return next(p);
+}
+
+static int isType(int c)
+{
+	return c == T_INT || c == T_DOUBLE || c == T_CHAR || c == T_STRING || c == T_VOID;
+}
+
+static int isAssignOp(int c)
+{
+	switch(c)
+	{
+	case T_ASSGN: case T_ADDASSGN: case T_SUBASSGN: case T_MULASSGN: case T_DIVASSGN:
+	case T_ANDASSGN: case T_ORASSGN: case T_XORASSGN: case T_MODASSGN:
+		return 1;
+	}
+	return 0;
+}
+
+/* precedence of a binary operator, as in sym.y's %left lines; 0 for anything else */
+static int binaryPrec(int c)
+{
+	switch(c)
+	{
+	case T_LOGOR:
+		return 1;
+	case T_LOGAND:
+		return 2;
+	case T_EQ: case T_NEQ:
+		return 3;
+	case T_LT: case T_GT: case T_LTEQ: case T_GTEQ:
+		return 4;
+	case T_ADD: case T_SUB:
+		return 5;
+	case T_MUL: case T_DIV: case T_MOD:
+		return 6;
+	}
+	return 0;
+}
+
+static NODEID logicalOr(RDPARSER *p);
+
+static NODEID leaf(RDPARSER *p, int kind)
+{
+	TOKVAL t = next(p);
+	return newleaf(p->cc, kind, t.id, t.loc);
+}
+
+/* Type */
+static NODEID type(RDPARSER *p)
+{
+	if(!isType(look(p)))
+		syntaxError(p, "a type");
+	return leaf(p, N_DATATYPE);
+}
+
+/* Expr: '(' LOGICALOREXPR ')' | T_NUM | T_ID */
+static NODEID expr(RDPARSER *p)
+{
+	NODEID e;
+	switch(look(p))
+	{
+	case '(':
+		nest(p);
+		next(p);
+		e = logicalOr(p);
+		expect(p, ')', "')'");
+		p->depth--;
+		return e;
+	case T_NUM:
+		return leaf(p, N_NUM);
+	case T_ID:
+		return leaf(p, N_ID);
+	}
+	syntaxError(p, "an expression");
+	return 0;
+}
+
+/* the operators after left that bind tighter than minprec, left to right */
+static NODEID binaryRest(RDPARSER *p, NODEID left, int minprec)
+{
+	TOKVAL op;
+	NODEID right;
+	int prec;
+	while((prec = binaryPrec(look(p))) >= minprec && prec != 0)
+	{
+		op = next(p);
+		right = expr(p);
+		while(binaryPrec(look(p)) > prec)
+			right = binaryRest(p, right, prec + 1);
+		left = opnode(p->cc, op.id, left, right, 0);
+	}
+	return left;
+}
+
+/* LOGICALOREXPR */
+static NODEID logicalOr(RDPARSER *p)
+{
+	return binaryRest(p, expr(p), 1);
+}
+
+/* UNREXPR, when its first Expr (if any) has already been read into e */
+static NODEID unaryRest(RDPARSER *p, NODEID e)
+{
+	TOKVAL t;
+	if(look(p) == T_INC || look(p) == T_DEC)
+	{
+		t = next(p);
+		return newnode(p->cc, N_UNARY, e, newleaf(p->cc, N_INCREMENT, t.id, t.loc), 0, 0);
+	}
+	return binaryRest(p, e, 1);
+}
+
+/* UNREXPR: T_INC Expr | T_DEC Expr | Expr T_INC | Expr T_DEC | LOGICALOREXPR */
+static NODEID unary(RDPARSER *p)
+{
+	TOKVAL t;
+	NODEID e;
+	if(look(p) == T_INC || look(p) == T_DEC)
+	{
+		t = next(p);
+		e = expr(p);
+		return newnode(p->cc, N_UNARY, newleaf(p->cc, N_INCREMENT, t.id, t.loc), e, 0, 0);
+	}
+	return unaryRest(p, expr(p));
+}
+
+/* Assignment and Assignment1, after the Expr on the left */
+static NODEID assignmentRest(RDPARSER *p, NODEID lhs)
+{
+	TOKVAL op;
+	if(!isAssignOp(look(p)))
+		syntaxError(p, "an assignment operator");
+	op = next(p);
+	return opnode(p->cc, op.id, lhs, logicalOr(p), 0);
+}
+
+/* X: ',' Assignment1 X | ',' T_ID X | empty */
+static NODEID declRest(RDPARSER *p)
+{
+	NODEID a, x;
+	if(look(p) != ',')
+		return 0;
+	next(p);
+	if(look(p) == T_ID && !isAssignOp(peek(p, 1)->code))
+	{
+		next(p);
+		x = declRest(p);
+		return newnode(p->cc, N_DECL_CONT, 0, x, 0, 0);
+	}
+	a = assignmentRest(p, expr(p));
+	x = declRest(p);
+	return newnode(p->cc, N_DECL_CONT, a, x, 0, 0);
+}
+
+/* Variable_declaration, after its Type and Expr */
+static NODEID varDeclRest(RDPARSER *p, NODEID t, NODEID e)
+{
+	NODEID v;
+	if(look(p) == T_ASSGN)
+	{
+		next(p);
+		v = logicalOr(p);
+		return newnode(p->cc, N_VAR_INIT, t, e, v, declRest(p));
+	}
+	return newnode(p->cc, N_VAR_DECL, t, e, declRest(p), 0);
+}
+
+/* INDEX: T_NUM | T_ID */
+static NODEID arrayIndex(RDPARSER *p)
+{
+	if(look(p) == T_NUM)
+		return leaf(p, N_NUM);
+	if(look(p) == T_ID)
+		return leaf(p, N_ID);
+	syntaxError(p, "an index");
+	return 0;
+}
+
+static NODEID emptyBrackets(RDPARSER *p);
+
+/* WI: '[' INDEX ']' | '[' INDEX ']' WOI */
+static NODEID indexBrackets(RDPARSER *p)
+{
+	NODEID i;
+	expect(p, '[', "'['");
+	i = arrayIndex(p);
+	expect(p, ']', "']'");
+	if(look(p) != '[')
+		return i;
+	return newnode(p->cc, N_BRACKET, i, emptyBrackets(p), 0, 0);
+}
+
+/* WOI: '[' ']' WI | '[' ']' */
+static NODEID emptyBrackets(RDPARSER *p)
+{
+	expect(p, '[', "'['");
+	expect(p, ']', "']'");
+	if(look(p) != '[')
+		return 0;
+	return newnode(p->cc, N_BRACKET, 0, indexBrackets(p), 0, 0);
+}
+
+/* Brackets: WI | WOI; like sym.y, the groups are built but the result is no node */
+static NODEID brackets(RDPARSER *p)
+{
+	if(peek(p, 1)->code == ']')
+		emptyBrackets(p);
+	else
+		indexBrackets(p);
+	return 0;
+}
+
+/* K: V | V ',' K | T_NEW Type WI, with V: T_NUM | '{' K '}' */
+static NODEID initList(RDPARSER *p)
+{
+	NODEID v, t;
+	if(look(p) == T_NEW)
+	{
+		next(p);
+		t = type(p);
+		return newnode(p->cc, N_NEW, t, indexBrackets(p), 0, 0);
+	}
+	if(look(p) == T_NUM)
+		v = leaf(p, N_NUM);
+	else if(look(p) == '{')
+	{
+		nest(p);
+		next(p);
+		v = initList(p);
+		expect(p, '}', "'}'");
+		p->depth--;
+	}
+	else
+	{
+		syntaxError(p, "a number, '{' or new");
+		return 0;
+	}
+	if(look(p) != ',')
+		return v;
+	next(p);
+	return newnode(p->cc, N_COMMA, v, initList(p), 0, 0);
+}
+
+static unsigned statements(RDPARSER *p);
+
+/* '{' S '}' as one N_BLOCK, or no node when it is empty */
+static NODEID body(RDPARSER *p)
+{
+	unsigned mark;
+	nest(p);
+	expect(p, '{', "'{'");
+	mark = statements(p);
+	expect(p, '}', "'}'");
+	p->depth--;
+	return block(p->cc, mark);
+}
+
+/* IF ELSE */
+static NODEID ifStatement(RDPARSER *p)
+{
+	NODEID c, i, e = 0;
+	next(p);
+	expect(p, '(', "'('");
+	c = logicalOr(p);
+	expect(p, ')', "')'");
+	i = newnode(p->cc, N_IF, c, body(p), 0, 0);
+	if(look(p) == T_ELSE)
+	{
+		next(p);
+		e = newnode(p->cc, N_ELSE, body(p), 0, 0, 0);
+	}
+	return newnode(p->cc, N_IF_ELSE, i, e, 0, 0);
+}
+
+/* FOR '{' S '}', where the three parts of FOR are each optional */
+static NODEID forStatement(RDPARSER *p)
+{
+	NODEID init = 0, cond = 0, step = 0, f, t;
+	next(p);
+	expect(p, '(', "'('");
+	if(isType(look(p)))
+	{
+		t = type(p);
+		init = expr(p);
+		init = varDeclRest(p, t, init);
+	}
+	else if(look(p) != ';')
+		init = assignmentRest(p, expr(p));
+	expect(p, ';', "';'");
+	if(look(p) != ';')
+		cond = logicalOr(p);
+	expect(p, ';', "';'");
+	if(look(p) != ')')
+		step = unary(p);
+	expect(p, ')', "')'");
+	f = newnode(p->cc, N_FOR_COND, init, cond, step, 0);
+	return newnode(p->cc, N_FOR, f, body(p), 0, 0);
+}
+
+/* DECLR ';' or an Array_initialisation ';', both starting with a Type */
+static NODEID declaration(RDPARSER *p)
+{
+	NODEID t, e, d;
+	TOKVAL op;
+	t = type(p);
+	if(look(p) == '[')
+	{
+		d = brackets(p);
+		d = newnode(p->cc, N_ARRAY_DECL, t, d, expr(p), 0);
+	}
+	else
+	{
+		e = expr(p);
+		if(look(p) != '[')
+			return newnode(p->cc, N_VAR_DECL_STMT, varDeclRest(p, t, e), 0, 0, 0);
+		d = newnode(p->cc, N_ARRAY_DECL, t, e, brackets(p), 0);
+	}
+	if(!isAssignOp(look(p)))
+		return newnode(p->cc, N_ARRAY_DECL_STMT, d, 0, 0, 0);
+	op = next(p);
+	d = opnode(p->cc, op.id, d, 0, initList(p));
+	return newnode(p->cc, N_ARRAY_INIT_STMT, d, 0, 0, 0);
+}
+
+/* one statement of S, pushed onto the open block */
+static void statement(RDPARSER *p)
+{
+	NODEID s, e;
+	switch(look(p))
+	{
+	case T_IF:
+		pushStmt(p->cc, ifStatement(p));
+		return;
+	case T_FOR:
+		pushStmt(p->cc, forStatement(p));
+		return;
+	case T_INT: case T_DOUBLE: case T_CHAR: case T_STRING: case T_VOID:
+		s = declaration(p);
+		break;
+	case T_INC: case T_DEC:
+		s = newnode(p->cc, N_STMT, unary(p), 0, 0, 0);
+		break;
+	case '(': case T_NUM: case T_ID:
+		e = expr(p);
+		if(isAssignOp(look(p)))
+			s = newnode(p->cc, N_ASSIGN_STMT, assignmentRest(p, e), 0, 0, 0);
+		else
+			s = newnode(p->cc, N_STMT, unaryRest(p, e), 0, 0, 0);
+		break;
+	default:
+		syntaxError(p, "a statement");
+		return;
+	}
+	expect(p, ';', "';'");
+	pushStmt(p->cc, s);
+}
+
+/* after an error: past the next ';', past a skipped block and its else, or up to the '}' closing this block */
+static void skipStatement(RDPARSER *p)
+{
+	int depth = 0, c;
+	while((c = look(p)) != 0)
+	{
+		if(c == ';' && depth == 0)
+		{
+			next(p);
+			return;
+		}
+		if(c == '}')
+		{
+			if(depth == 0)
+				return;
+			next(p);
+			if(--depth == 0 && look(p) != T_ELSE)
+				return;
+			continue;
+		}
+		if(c == '{')
+			depth++;
+		next(p);
+	}
+}
+
+/*
+	S: the statements up to the '}' of their block. Returns where they
+	start in the statement stack, for block(). A statement with a syntax
+	error leaves nothing behind.
+*/
+static unsigned statements(RDPARSER *p)
+{
+	sigjmp_buf here, *outer = p->recover;
+	unsigned mark = p->cc->nstmt, at, depth = p->depth;
+	while(look(p) != '}' && look(p) != 0)
+	{
+		at = p->cc->nstmt;
+		if(sigsetjmp(here, 0) != 0)
+		{
+			p->cc->nstmt = at;
+			p->depth = depth;
+			skipStatement(p);
+			continue;
+		}
+		p->recover = &here;
+		statement(p);
+	}
+	p->recover = outer;
+	return mark;
+}
+
+/* MODIFIER: W1 W2 */
+static NODEID modifier(RDPARSER *p)
+{
+	NODEID a, s = 0;
+	if(look(p) != T_PUBLIC && look(p) != T_PRIVATE)
+		syntaxError(p, "public or private");
+	a = leaf(p, N_ACCESS_MODIFIER);
+	if(look(p) == T_STATIC)
+		s = leaf(p, N_ACCESS_MODIFIER);
+	return newnode(p->cc, N_MODIFIER, a, s, 0, 0);
+}
+
+/* Method_declaration */
+static NODEID method(RDPARSER *p)
+{
+	NODEID m, t, a;
+	m = modifier(p);
+	t = type(p);
+	expect(p, T_MAIN, "main");
+	expect(p, '(', "'('");
+	a = type(p);
+	expect(p, '[', "'['");
+	expect(p, ']', "']'");
+	expect(p, T_ARGS, "args");
+	expect(p, ')', "')'");
+	return newnode(p->cc, N_METHOD_DECL, m, t, a, body(p));
+}
+
+/*
+	Parses the source opened in cc->lex into cc->ast, like yyparse().
+	Returns 0 on success; errors are counted in cc->errors.
+*/
+int rdParse(COMPILATION *cc)
+{
+	RDPARSER p;
+	sigjmp_buf top;
+	NODEID m, d;
+	memset(&p, 0, sizeof(p));
+	p.cc = cc;
+	p.top = &top;
+	if(sigsetjmp(top, 0) != 0)
+		return -1;
+	m = modifier(&p);
+	expect(&p, T_CLASS, "class");
+	expect(&p, T_ID, "a class name");
+	expect(&p, '{', "'{'");
+	d = method(&p);
+	expect(&p, '}', "'}'");
+	expect(&p, 0, "end of input");
+	if(cc->errors != 0)
+		return -1;
+	cc->ast.root = newnode(cc, N_CLASS_DECL, m, newleaf(cc, N_CLASSNAME, cc->ast.val[child(&cc->ast, m, 0)], cc->ast.loc[m]), d, 0);
+	return 0;
+}
@@ -3,297 +3,656 @@
 	#include <string.h>
 	#include <stdio.h>
 	#include "header.c"
-	FILE *yyin;
-	
-	#define YYSTYPE YACC
-	int yylex();
-	char* type;
-	int err = 0;
-	FILE* fp;
-	
-	int scope = 0;
-	
 
-	AST* ast;
-	TREE* nptr=NULL;
-
-	TREE* newnode(char*,TREE*,TREE*,TREE*,TREE*);
-	TREE* newleaf(char*,char*);
-	void display(TREE*);
-	void yyerror(char* s);
-	void printBT(char* prefix, TREE* node, int isLeft);
+	static const NODEID nptr = 0;
+
+	void yyerror(LEXER *lx, COMPILATION *cc, const char *s);
+	void initCompilation(COMPILATION *cc);
+	void freeCompilation(COMPILATION *cc);
+	int compileSource(COMPILATION *cc);
+	NODEID newnode(COMPILATION *cc,int,NODEID,NODEID,NODEID,NODEID);
+	NODEID newleaf(COMPILATION *cc,int,int,unsigned);
+	NODEID opnode(COMPILATION *cc,int,NODEID,NODEID,NODEID);
+	void pushStmt(COMPILATION *cc, NODEID stmt);
+	NODEID block(COMPILATION *cc, unsigned mark);
+	NODEID child(AST *ast, NODEID node, unsigned i);
+	void freeAST(AST *a);
+	void display(COMPILATION *cc, NODEID);
+	void printAST(COMPILATION *cc, FILE *f, NODEID root);
+	unsigned astDepth(AST *ast, NODEID root);
+	int tokenLogMode(char *s);
+	void openTokenLog(TOKLOG *tl, int mode);
+	void closeTokenLog(TOKLOG *tl);
+	int openTokenStream(LEXER *lx, char *path);
+	void closeTokenStream(LEXER *lx);
+	int openSource(LEXER *lx, char *path);
+	void closeSource(LEXER *lx);
+	int openReplay(LEXER *lx, char *tokpath, char *srcpath);
+	void closeReplay(LEXER *lx);
+	int openSourceParallel(LEXER *lx, char *path, int nthreads);
+	void initLexer(LEXER *lx);
+	void freeLexer(LEXER *lx);
+	char* internStr(INTERNPOOL *ip, int id);
+	void buildLineTable(LINETAB *lt);
+	unsigned offsetLine(LINETAB *lt, unsigned off, unsigned *col);
+	int rdParse(COMPILATION *cc) __attribute__((weak));
 	
 %}
-%token T_CLASS T_PUBLIC T_PRIVATE T_STATIC T_FINAL T_VOID T_INT T_CHAR T_DOUBLE T_IF T_ELSE T_NEW T_INC T_DEC T_LOGOR T_LOGAND T_OR T_AND T_EQ T_NEQ T_GTEQ T_LTEQ T_ADD T_SUB T_MUL T_DIV T_GT T_LT T_XOR T_MOD T_LS T_RS T_NUM T_ID T_STRING T_ARGS T_PRINT T_FOR T_MAIN T_ASSGN T_MULASSGN T_DIVASSGN T_MODASSGN T_ADDASSGN T_SUBASSGN T_ANDASSGN T_XORASSGN T_ORASSGN
+/*
+	Pure: no globals. The scanner's state is the LEXER passed to yylex()
+	and the tree being built is in the COMPILATION, both from yyparse().
+*/
+%define api.pure full
+%param {LEXER *lx}
+%parse-param {COMPILATION *cc}
+%code provides
+{
+	int yylex(YYSTYPE *lval, LEXER *lx);
+}
+%union
+{
+	TOKVAL tok;		/* tokens */
+	NODEID ptr;		/* nonterminals */
+	unsigned mark;	/* S: where its statements start in stmts[] */
+}
+%token <tok> T_CLASS T_PUBLIC T_PRIVATE T_STATIC T_FINAL T_VOID T_INT T_CHAR T_DOUBLE T_IF T_ELSE T_NEW T_INC T_DEC T_LOGOR T_LOGAND T_OR T_AND T_EQ T_NEQ T_GTEQ T_LTEQ T_ADD T_SUB T_MUL T_DIV T_GT T_LT T_XOR T_MOD T_LS T_RS T_NUM T_ID T_STRING T_ARGS T_PRINT T_FOR T_MAIN T_ASSGN T_MULASSGN T_DIVASSGN T_MODASSGN T_ADDASSGN T_SUBASSGN T_ANDASSGN T_XORASSGN T_ORASSGN
+%type <ptr> START Method_declaration MODIFIER W1 W2 ASSGN DECLR IF ELSE FOR INIT UNREXPR
+%type <ptr> Variable_declaration X Assignment1 Array_declaration Brackets WOI WI INDEX
+%type <ptr> Array_initialisation K V R Type Assignment
+%type <ptr> LOGICALOREXPR Expr
+%type <tok> Assignment_operator
+%type <mark> S
+%left T_LOGOR
+%left T_LOGAND
+%left T_EQ T_NEQ
+%left T_LT T_GT T_LTEQ T_GTEQ
+%left T_ADD T_SUB
+%left T_MUL T_DIV T_MOD
 %%
-START:MODIFIER T_CLASS T_ID '{'Method_declaration'}' {$$.ptr=newnode("CLASS DECLARATION",$1.ptr,newleaf("classname",$1.v),$5.ptr,nptr);ast->root = $$.ptr;};
+START:MODIFIER T_CLASS T_ID '{'Method_declaration'}' {$$=newnode(cc,N_CLASS_DECL,$1,newleaf(cc,N_CLASSNAME,cc->ast.val[child(&cc->ast,$1,0)],cc->ast.loc[$1]),$5,nptr);cc->ast.root = $$;};
 
-Method_declaration:MODIFIER Type T_MAIN'('Type'['']' T_ARGS')' '{'S'}' {$$.ptr=newnode("METHOD DECLARATION",$1.ptr,$2.ptr,$5.ptr,$11.ptr);};
+Method_declaration:MODIFIER Type T_MAIN'('Type'['']' T_ARGS')' '{'S'}' {$$=newnode(cc,N_METHOD_DECL,$1,$2,$5,block(cc,$11));};
 
-MODIFIER:W1 W2{$$.ptr=newnode("modifier",$1.ptr,$2.ptr,nptr,nptr);};
+MODIFIER:W1 W2{$$=newnode(cc,N_MODIFIER,$1,$2,nptr,nptr);};
 
-W1:T_PUBLIC {$$.ptr=newleaf("access modifier",$1.v);}
-   |T_PRIVATE {$$.ptr=newleaf("access modifier",$1.v);};
+W1:T_PUBLIC {$$=newleaf(cc,N_ACCESS_MODIFIER,$1.id,$1.loc);}
+   |T_PRIVATE {$$=newleaf(cc,N_ACCESS_MODIFIER,$1.id,$1.loc);};
 
-W2:T_STATIC {$$.ptr=newleaf("access modifier",$1.v);};
-	|{$$.ptr=nptr;};
+W2:T_STATIC {$$=newleaf(cc,N_ACCESS_MODIFIER,$1.id,$1.loc);};
+	|{$$=nptr;};
 
-S:		DECLR ';' S		{$$.ptr=newnode("DECLARATION",$1.ptr,$3.ptr,nptr,nptr);}
-		|ASSGN ';' S	{$$.ptr=newnode("INITIALIZATION",$1.ptr,$3.ptr,nptr,nptr);}
-		|IF ELSE S		{$$.ptr=newnode("IF ELSE STATEMNET",$1.ptr,$2.ptr,$3.ptr,nptr);}
-		|FOR '{'S'}' S	{$$.ptr=newnode("FOR LOOP",$1.ptr,$3.ptr,$5.ptr,nptr);}
-		|UNREXPR';' S	{$$.ptr=newnode("STATEMENT",$1.ptr,$3.ptr,nptr,nptr);}
-		|;
+S:		S DECLR ';'		{pushStmt(cc,$2);}
+		|S ASSGN ';'	{pushStmt(cc,$2);}
+		|S IF ELSE		{pushStmt(cc,newnode(cc,N_IF_ELSE,$2,$3,nptr,nptr));}
+		|S FOR '{'S'}'	{pushStmt(cc,newnode(cc,N_FOR,$2,block(cc,$4),nptr,nptr));}
+		|S UNREXPR';'	{pushStmt(cc,newnode(cc,N_STMT,$2,nptr,nptr,nptr));}
+		|{$$=cc->nstmt;};
 
-ASSGN:	Assignment{$$.ptr=newnode("ASSIGNMENT STATEMENT",$1.ptr,nptr,nptr,nptr);}
-		|Array_initialisation{$$.ptr=newnode("ARRAY INITIALISATION STATEMENT",$1.ptr,nptr,nptr,nptr);};
+ASSGN:	Assignment{$$=newnode(cc,N_ASSIGN_STMT,$1,nptr,nptr,nptr);}
+		|Array_initialisation{$$=newnode(cc,N_ARRAY_INIT_STMT,$1,nptr,nptr,nptr);};
 
-DECLR:	Variable_declaration{$$.ptr=newnode("VARIABLE DECLARATION",$1.ptr,nptr,nptr,nptr);}
-		|Array_declaration{$$.ptr=newnode("ARRAY DECLARATION STATEMENT",$1.ptr,nptr,nptr,nptr);};
+DECLR:	Variable_declaration{$$=newnode(cc,N_VAR_DECL_STMT,$1,nptr,nptr,nptr);}
+		|Array_declaration{$$=newnode(cc,N_ARRAY_DECL_STMT,$1,nptr,nptr,nptr);};
 
-IF:		T_IF '('LOGICALOREXPR')' '{'S'}'{$$.ptr=newnode("IF STATEMENT",$3.ptr,$6.ptr,nptr,nptr);};
+IF:		T_IF '('LOGICALOREXPR')' '{'S'}'{$$=newnode(cc,N_IF,$3,block(cc,$6),nptr,nptr);};
 
-ELSE:	T_ELSE '{'S'}' {$$.ptr=newnode("ELSE STATEMENT",$3.ptr,nptr,nptr,nptr);}
-		|{$$.ptr=nptr;};
+ELSE:	T_ELSE '{'S'}' {$$=newnode(cc,N_ELSE,block(cc,$3),nptr,nptr,nptr);}
+		|{$$=nptr;};
 
-FOR:	T_FOR'('';'';'')' 						{$$.ptr=newnode("FOR CONDITION",nptr,nptr,nptr,nptr);}
-		|T_FOR'('INIT';'';'')'				{$$.ptr=newnode("FOR CONDITION",$3.ptr,nptr,nptr,nptr);}
-		|T_FOR'('INIT';'LOGICALOREXPR';'')'	{$$.ptr=newnode("FOR CONDITION",$3.ptr,$5.ptr,nptr,nptr);}
-		|T_FOR'('INIT';'';'UNREXPR')'				{$$.ptr=newnode("FOR CONDITION",$3.ptr,nptr,$6.ptr,nptr);}
-		|T_FOR'('';'LOGICALOREXPR';'')'			{$$.ptr=newnode("FOR CONDITION",nptr,$4.ptr,nptr,nptr);}
-		|T_FOR'('';'LOGICALOREXPR';'UNREXPR')'			{$$.ptr=newnode("FOR CONDITION",nptr,$4.ptr,$6.ptr,nptr);}
-		|T_FOR'('INIT';'LOGICALOREXPR';'UNREXPR')'	{$$.ptr=newnode("FOR CONDITION",$3.ptr,$5.ptr,$7.ptr,nptr);}
-		|T_FOR'('';'';'UNREXPR')'						{$$.ptr=newnode("FOR CONDITION",nptr,nptr,$5.ptr,nptr);};
+FOR:	T_FOR'('';'';'')' 						{$$=newnode(cc,N_FOR_COND,nptr,nptr,nptr,nptr);}
+		|T_FOR'('INIT';'';'')'				{$$=newnode(cc,N_FOR_COND,$3,nptr,nptr,nptr);}
+		|T_FOR'('INIT';'LOGICALOREXPR';'')'	{$$=newnode(cc,N_FOR_COND,$3,$5,nptr,nptr);}
+		|T_FOR'('INIT';'';'UNREXPR')'				{$$=newnode(cc,N_FOR_COND,$3,nptr,$6,nptr);}
+		|T_FOR'('';'LOGICALOREXPR';'')'			{$$=newnode(cc,N_FOR_COND,nptr,$4,nptr,nptr);}
+		|T_FOR'('';'LOGICALOREXPR';'UNREXPR')'			{$$=newnode(cc,N_FOR_COND,nptr,$4,$6,nptr);}
+		|T_FOR'('INIT';'LOGICALOREXPR';'UNREXPR')'	{$$=newnode(cc,N_FOR_COND,$3,$5,$7,nptr);}
+		|T_FOR'('';'';'UNREXPR')'						{$$=newnode(cc,N_FOR_COND,nptr,nptr,$5,nptr);};
 
-INIT: 	Variable_declaration	{$$.ptr=$1.ptr;}
-		|Assignment	{$$.ptr=$1.ptr;};
+INIT: 	Variable_declaration	{$$=$1;}
+		|Assignment	{$$=$1;};
 
-UNREXPR:		T_INC Expr{$$.ptr=newnode("UNARY OPERATION",newleaf("increment",$1.v),$2.ptr,nptr,nptr);}
-		|T_DEC Expr{$$.ptr=newnode("UNARY OPERATION",newleaf("increment",$1.v),$2.ptr,nptr,nptr);}
-		|Expr T_INC {$$.ptr=newnode("UNARY OPERATION",$1.ptr,newleaf("increment",$2.v),nptr,nptr);}
-		|Expr T_DEC {$$.ptr=newnode("UNARY OPERATION",$1.ptr,newleaf("increment",$2.v),nptr,nptr);}
+UNREXPR:		T_INC Expr{$$=newnode(cc,N_UNARY,newleaf(cc,N_INCREMENT,$1.id,$1.loc),$2,nptr,nptr);}
+		|T_DEC Expr{$$=newnode(cc,N_UNARY,newleaf(cc,N_INCREMENT,$1.id,$1.loc),$2,nptr,nptr);}
+		|Expr T_INC {$$=newnode(cc,N_UNARY,$1,newleaf(cc,N_INCREMENT,$2.id,$2.loc),nptr,nptr);}
+		|Expr T_DEC {$$=newnode(cc,N_UNARY,$1,newleaf(cc,N_INCREMENT,$2.id,$2.loc),nptr,nptr);}
 		|LOGICALOREXPR;
 
 
-Variable_declaration:Type Expr T_ASSGN LOGICALOREXPR X {$$.ptr=newnode("variable initialisation",$1.ptr,$2.ptr,$4.ptr,$5.ptr);}
-		|Type Expr X {$$.ptr=newnode("variable declaration",$1.ptr,$2.ptr,$3.ptr,nptr);};
-
-//Identifier_list:','Expr T_ASSGN LOGICALOREXPR Identifier_list {$$.ptr=newnode("identifier list",$2.ptr,$4.ptr,$5.ptr,nptr);}
-//			|','T_ID Identifier_list {$$.ptr=newnode("identifier list",$2.ptr,$3.ptr,nptr,nptr);}|{$$.ptr=nptr;};
+Variable_declaration:Type Expr T_ASSGN LOGICALOREXPR X {$$=newnode(cc,N_VAR_INIT,$1,$2,$4,$5);}
+		|Type Expr X {$$=newnode(cc,N_VAR_DECL,$1,$2,$3,nptr);};
 
-X:	','Assignment1 X {$$.ptr=newnode("declaration continued",$2.ptr,$3.ptr,nptr,nptr);}
-	|',' T_ID X	{$$.ptr=newnode("declaration continued",$2.ptr,$3.ptr,nptr,nptr);}
-	|{$$.ptr=nptr;};
+//Identifier_list:','Expr T_ASSGN LOGICALOREXPR Identifier_list {$$=newnode(cc,N_ID_LIST,$2,$4,$5,nptr);}
+//			|','T_ID Identifier_list {$$=newnode(cc,N_ID_LIST,$2,$3,nptr,nptr);}|{$$=nptr;};
 
-Assignment1:Expr Assignment_operator LOGICALOREXPR {$$.ptr=newnode($2.v,$1.ptr,$3.ptr,nptr,nptr);};
+X:	','Assignment1 X {$$=newnode(cc,N_DECL_CONT,$2,$3,nptr,nptr);}
+	|',' T_ID X	{$$=newnode(cc,N_DECL_CONT,nptr,$3,nptr,nptr);}
+	|{$$=nptr;};
 
-Array_declaration:Type Brackets Expr {$$.ptr=newnode("array declaration",$1.ptr,$2.ptr,$3.ptr,nptr);}
-			|Type Expr Brackets {$$.ptr=newnode("array declaration",$1.ptr,$2.ptr,$3.ptr,nptr);};
+Assignment1:Expr Assignment_operator LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);};
 
-Brackets: 	WI{$$.ptr=nptr;}
-			|WOI{$$.ptr=nptr;};
+Array_declaration:Type Brackets Expr {$$=newnode(cc,N_ARRAY_DECL,$1,$2,$3,nptr);}
+			|Type Expr Brackets {$$=newnode(cc,N_ARRAY_DECL,$1,$2,$3,nptr);};
 
-WOI:			'['']'WI {$$.ptr=newnode("bracket",$2.ptr,$3.ptr,nptr,nptr);}
-			|'['']'{$$.ptr=nptr;};
+Brackets: 	WI{$$=nptr;}
+			|WOI{$$=nptr;};
 
-WI:		'[' INDEX ']' {$$.ptr=$2.ptr;} 
-			| '[' INDEX ']' WOI {$$.ptr=newnode("bracket",$2.ptr,$4.ptr,nptr,nptr);}; 
+WOI:			'['']'WI {$$=newnode(cc,N_BRACKET,nptr,$3,nptr,nptr);}
+			|'['']'{$$=nptr;};
 
-INDEX: 		T_NUM {$$.ptr=newleaf("num",$1.v);}
-			| T_ID {$$.ptr=newleaf("id",$1.v);};
+WI:		'[' INDEX ']' {$$=$2;} 
+			| '[' INDEX ']' WOI {$$=newnode(cc,N_BRACKET,$2,$4,nptr,nptr);}; 
 
-Array_initialisation:Array_declaration Assignment_operator K {$$.ptr=newnode($2.v,$1.ptr,$2.ptr,$3.ptr,nptr);};
+INDEX: 		T_NUM {$$=newleaf(cc,N_NUM,$1.id,$1.loc);}
+			| T_ID {$$=newleaf(cc,N_ID,$1.id,$1.loc);};
 
-K:			V {$$.ptr=$1.ptr;}
-			|V','K {$$.ptr=newnode(",",$1.ptr,$3.ptr,nptr,nptr);}
-			|T_NEW Type WI {$$.ptr=newnode("new",$2.ptr,$3.ptr,nptr,nptr);};
+Array_initialisation:Array_declaration Assignment_operator K {$$=opnode(cc,$2.id,$1,nptr,$3);};
 
-V:			T_NUM {$$.ptr=newleaf("num",$1.v);}
-			|R {$$.ptr=$1.ptr;};
+K:			V {$$=$1;}
+			|V','K {$$=newnode(cc,N_COMMA,$1,$3,nptr,nptr);}
+			|T_NEW Type WI {$$=newnode(cc,N_NEW,$2,$3,nptr,nptr);};
 
-R:			'{'K'}' {$$.ptr=$2.ptr;};
+V:			T_NUM {$$=newleaf(cc,N_NUM,$1.id,$1.loc);}
+			|R {$$=$1;};
 
-Type:		T_INT {$$.ptr=newleaf("datatype",$1.v);}
-			|T_DOUBLE {$$.ptr=newleaf("datatype",$1.v);}
-			|T_CHAR {$$.ptr=newleaf("datatype",$1.v);}
-			|T_STRING {$$.ptr=newleaf("datatype",$1.v);}
-			|T_VOID {$$.ptr=newleaf("datatype",$1.v);};
+R:			'{'K'}' {$$=$2;};
 
-Assignment:Expr Assignment_operator LOGICALOREXPR {$$.ptr=newnode($2.v,$1.ptr,$3.ptr,nptr,nptr);};
+Type:		T_INT {$$=newleaf(cc,N_DATATYPE,$1.id,$1.loc);}
+			|T_DOUBLE {$$=newleaf(cc,N_DATATYPE,$1.id,$1.loc);}
+			|T_CHAR {$$=newleaf(cc,N_DATATYPE,$1.id,$1.loc);}
+			|T_STRING {$$=newleaf(cc,N_DATATYPE,$1.id,$1.loc);}
+			|T_VOID {$$=newleaf(cc,N_DATATYPE,$1.id,$1.loc);};
 
-Assignment_operator:T_ASSGN{$$.v = strdup($1.v);}
-				|T_ADDASSGN{$$.v = strdup($1.v);}
-				|T_SUBASSGN{$$.v = strdup($1.v);}
-				|T_MULASSGN{$$.v = strdup($1.v);}
-				|T_DIVASSGN{$$.v = strdup($1.v);}
-				|T_ANDASSGN{$$.v = strdup($1.v);}
-				|T_ORASSGN{$$.v = strdup($1.v);}
-				|T_XORASSGN{$$.v = strdup($1.v);}
-				|T_MODASSGN{$$.v = strdup($1.v);};
+Assignment:Expr Assignment_operator LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);};
 
-LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALANDEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		|LOGICALANDEXPR	{$$.ptr=$1.ptr;};
+Assignment_operator:T_ASSGN{$$ = $1;}
+				|T_ADDASSGN{$$ = $1;}
+				|T_SUBASSGN{$$ = $1;}
+				|T_MULASSGN{$$ = $1;}
+				|T_DIVASSGN{$$ = $1;}
+				|T_ANDASSGN{$$ = $1;}
+				|T_ORASSGN{$$ = $1;}
+				|T_XORASSGN{$$ = $1;}
+				|T_MODASSGN{$$ = $1;};
 
-LOGICALANDEXPR: LOGICALANDEXPR T_LOGAND EQUALITYEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		|EQUALITYEXPR	{$$.ptr=$1.ptr;};
+/*
+	One rule per binary operator. The %left lines above give their
+	precedence, so an operand goes straight from Expr to LOGICALOREXPR
+	with no chain of single-symbol reductions through every level.
+*/
+LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_LOGAND LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_EQ LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_NEQ LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_LT LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_GT LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_LTEQ LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_GTEQ LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_ADD LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_SUB LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_MUL LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_DIV LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| LOGICALOREXPR T_MOD LOGICALOREXPR {$$=opnode(cc,$2.id,$1,$3,nptr);}
+		| Expr	{$$=$1;};
 
-EQUALITYEXPR: EQUALITYEXPR T_EQ RELEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| EQUALITYEXPR T_NEQ RELEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		|RELEXPR	{$$.ptr=$1.ptr;};
+Expr:			'('LOGICALOREXPR')' {$$=$2;}
+				|T_NUM {$$=newleaf(cc,N_NUM,$1.id,$1.loc);}
+				|T_ID {$$=newleaf(cc,N_ID,$1.id,$1.loc);};
 
-RELEXPR:  RELEXPR T_LT ADDEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| RELEXPR T_GT ADDEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| RELEXPR T_LTEQ ADDEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| RELEXPR T_GTEQ ADDEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		|ADDEXPR	{$$.ptr=$1.ptr;};
+%%
+void yyerror(LEXER *lx, COMPILATION *cc, const char *s)
+{
+	(void)lx;
+	(void)s;
+	cc->errors++;
+}
 
-ADDEXPR:  ADDEXPR T_ADD MULTEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| ADDEXPR T_SUB MULTEXPR {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		|MULTEXPR	{$$.ptr=$1.ptr;};
+void initCompilation(COMPILATION *cc)
+{
+	memset(cc, 0, sizeof(COMPILATION));
+	initLexer(&cc->lex);
+}
 
-MULTEXPR: MULTEXPR T_MUL Expr {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| MULTEXPR T_DIV Expr {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| MULTEXPR T_MOD Expr {$$.ptr=newnode(strdup($2.v),$1.ptr,$3.ptr,nptr,nptr);}
-		| Expr	{$$.ptr=$1.ptr;};
+/* frees the tree and the lexer; cc->out, the token log and the sources are closed before */
+void freeCompilation(COMPILATION *cc)
+{
+	freeAST(&cc->ast);
+	free(cc->stmts);
+	freeLexer(&cc->lex);
+	initCompilation(cc);
+}
 
-Expr:			'('LOGICALOREXPR')' {$$.ptr=$2.ptr;}
-				|T_NUM {$$.ptr=newleaf("num",$1.v);}
-				|T_ID {$$.ptr=newleaf("id",$1.v);};
+/* what compileSource() writes to cc->out; main() calls it AST.txt */
+const char outputFile[] = "AST.txt";
 
-%%
-void yyerror(char *s)
+/*
+	Parses the source opened in cc->lex and, when it parses, writes the
+	tree to cc->out. Returns 0 on success. main() and the batch driver
+	(Lexer/batch.c) both compile through it. With cc->rd set the parse is
+	done by the recursive-descent parser in rdparse.c.
+*/
+int compileSource(COMPILATION *cc)
 {
-	yynerrs+=1;
+	if((cc->rd ? rdParse(cc) : yyparse(&cc->lex, cc)) != 0)
+		return -1;
+	if(cc->showloc)
+		buildLineTable(&cc->lex.lines);
+	fprintf(cc->out,"Abstract Syntax Tree\n");
+	printAST(cc,cc->out,cc->ast.root);
+	fprintf(cc->out,"\n");
+	return 0;
 }
+
 int main(int argc, char* argv[])
 {
-	fp = fopen("AST.txt", "w");
-	ast = (AST*)malloc(sizeof(AST));
-	ast->root = NULL;
-	yyin = fopen(argv[1], "r");
-	if(!yyparse())
+	COMPILATION cc;
+	AST *ast = &cc.ast;
+	int i, ok, tokmode = 2;
+	char *replayfile = NULL;
+	int jobs = 0;
+	int showstats = 0;
+	initCompilation(&cc);
+	for(i=2;i<argc;i++)
+		if(strncmp(argv[i],"--tokens=",9)==0)
+		{
+			if((tokmode = tokenLogMode(argv[i]+9)) < 0)
+				break;
+		}
+		else if(strncmp(argv[i],"--tokbin=",9)==0)
+			openTokenStream(&cc.lex, argv[i]+9);
+		else if(strncmp(argv[i],"--replay=",9)==0)
+			replayfile = argv[i]+9;
+		else if(strncmp(argv[i],"--jobs=",7)==0)
+			jobs = atoi(argv[i]+7);
+		else if(strcmp(argv[i],"--locations")==0)
+			cc.showloc = 1;
+		else if(strcmp(argv[i],"--stats")==0)
+			showstats = 1;
+		else if(strcmp(argv[i],"--rd")==0)
+			cc.rd = 1;
+	if(argc < 2 || tokmode < 0)
+	{
+		printf("usage: %s file [--tokens=off|summary|full] ...\n", argv[0]);
+		return 1;
+	}
+	if(cc.rd && rdParse == NULL)
+	{
+		printf("--rd: built without rdparse.c\n");
+		return 1;
+	}
+	openTokenLog(&cc.lex.log, tokmode);
+	cc.out = fopen(outputFile, "w");
+	if(replayfile != NULL)
+	{
+		if(openReplay(&cc.lex, replayfile, argv[1]) != 0)
+		{
+			printf("cannot replay %s\n", replayfile);
+			return 1;
+		}
+	}
+	else if((jobs > 0 ? openSourceParallel(&cc.lex, argv[1], jobs) : openSource(&cc.lex, argv[1])) != 0)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	ok = compileSource(&cc) == 0;
+	closeTokenLog(&cc.lex.log);
+	closeTokenStream(&cc.lex);
+	closeReplay(&cc.lex);
+	closeSource(&cc.lex);
+	if(ok)
 	{
 		
 		printf("Parsing succesful\n");
 		printf("AST generated\n");
-
-		fprintf(fp,"Abstract Syntax Tree\n");
-		
-		printBT("",ast->root,0);
-		fprintf(fp,"\n");
-		fclose(fp);
+		fclose(cc.out);
+		if(showstats)
+			printf("AST: %u nodes, %zu bytes, depth %u\n", ast->n - 1,
+				(size_t)ast->n*(1 + sizeof(int) + 3*sizeof(unsigned)) + (size_t)ast->nkid*sizeof(NODEID),
+				astDepth(ast, ast->root));
+		freeCompilation(&cc);
 		return 0;
 	}
 	else
 	{
 		printf("Unsuccessful\n");
 	}
+	freeCompilation(&cc);
 	return 0;
 }
 
 
-TREE* newnode(char* o,TREE* c1,TREE* c2,TREE* c3,TREE* c4)
+/* labels written to AST.txt, indexed by NODEKIND */
+static const char *nodename[N_LAST+1] = {
+	[N_CLASS_DECL] = "CLASS DECLARATION", [N_METHOD_DECL] = "METHOD DECLARATION",
+	[N_MODIFIER] = "modifier", [N_ACCESS_MODIFIER] = "access modifier",
+	[N_CLASSNAME] = "classname", [N_BLOCK] = "BLOCK", [N_STMT] = "STATEMENT",
+	[N_ASSIGN_STMT] = "ASSIGNMENT STATEMENT",
+	[N_VAR_DECL_STMT] = "VARIABLE DECLARATION", [N_ARRAY_DECL_STMT] = "ARRAY DECLARATION STATEMENT",
+	[N_ARRAY_INIT_STMT] = "ARRAY INITIALISATION STATEMENT", [N_IF] = "IF STATEMENT",
+	[N_IF_ELSE] = "IF ELSE STATEMNET", [N_ELSE] = "ELSE STATEMENT", [N_FOR] = "FOR LOOP",
+	[N_FOR_COND] = "FOR CONDITION", [N_UNARY] = "UNARY OPERATION",
+	[N_INCREMENT] = "increment", [N_VAR_DECL] = "variable declaration",
+	[N_VAR_INIT] = "variable initialisation", [N_DECL_CONT] = "declaration continued",
+	[N_ID_LIST] = "identifier list", [N_COMMA] = ",", [N_ARRAY_DECL] = "array declaration",
+	[N_BRACKET] = "bracket", [N_NEW] = "new", [N_DATATYPE] = "datatype", [N_NUM] = "num",
+	[N_ID] = "id",
+};
+
+static const char* nodeLabel(COMPILATION *cc, NODEID node)
 {
-	TREE* temp = (TREE*)malloc(sizeof(TREE));
-	temp->opr= strdup(o);
-	temp->value = strdup("N/A");
-	temp->c1 = c1;
-	temp->c2 = c2;
-	temp->c3 = c3;
-	temp->c4 = c4;
-	return temp;
+	AST *ast = &cc->ast;
+	return ast->kind[node] == N_OP ? internStr(&cc->lex.names, ast->val[node]) : nodename[ast->kind[node]];
 }
 
-TREE* newleaf(char* o, char* v)
+/* a leaf's spelling, or N/A for nodes without one */
+static char* nodeValue(COMPILATION *cc, NODEID node)
 {
-	TREE* temp = (TREE*)malloc(sizeof(TREE));
-	temp->opr = strdup(o);
-	temp->value = strdup(v);
-	temp->c1 = NULL;
-	temp->c2 = NULL;
-	temp->c3 = NULL;
-	temp->c4 = NULL;
-	return temp;
+	return cc->ast.val[node] ? internStr(&cc->lex.names, cc->ast.val[node]) : "N/A";
 }
 
-void display(TREE* r)
-{	
-	
-	if(r==NULL)
-		return;
-	if(r->c1==NULL && r->c2==NULL && r->c3==NULL)
+/* appends a node with room for n children and returns its id */
+static NODEID addNode(AST *ast, int kind, int val, unsigned loc, int n)
+{
+	NODEID id;
+	if(ast->n + 1 >= ast->cap)
 	{
-		printf("(");
-		printf("%s\t%s)\n",r->opr,r->value);
+		ast->cap = ast->cap ? ast->cap*2 : 4096;
+		ast->kind = (unsigned char*)realloc(ast->kind, ast->cap);
+		ast->nkids = (unsigned*)realloc(ast->nkids, ast->cap*sizeof(unsigned));
+		ast->val = (int*)realloc(ast->val, ast->cap*sizeof(int));
+		ast->loc = (unsigned*)realloc(ast->loc, ast->cap*sizeof(unsigned));
+		ast->first = (unsigned*)realloc(ast->first, ast->cap*sizeof(unsigned));
+		if(ast->n == 0)
+		{
+			ast->kind[0] = ast->nkids[0] = 0;
+			ast->val[0] = 0;
+			ast->loc[0] = ast->first[0] = 0;
+			ast->n = 1;
+		}
 	}
-	else
-		printf("%s\n",r->opr);
-	display(r->c1);
-	display(r->c2);
-	display(r->c3);
-	display(r->c4);
+	while(ast->nkid + n > ast->kidcap)
+	{
+		ast->kidcap = ast->kidcap ? ast->kidcap*2 : 4096;
+		ast->kids = (NODEID*)realloc(ast->kids, ast->kidcap*sizeof(NODEID));
+	}
+	id = ast->n++;
+	ast->kind[id] = kind;
+	ast->nkids[id] = n;
+	ast->val[id] = val;
+	ast->loc[id] = loc;
+	ast->first[id] = ast->nkid;
+	ast->nkid += n;
+	return id;
 }
 
-void printBT(char* prefix, TREE* node, int isLeft)
-{	
-	
-	if(node==NULL)
-		return;
-    if( node != NULL)
-    {
-       fprintf(fp,"%s",prefix);
-
-       	if(isLeft==0)
-       		fprintf(fp,"└──");
-       	else
-       		fprintf(fp,"├──");
-      if(node->c1==NULL && node->c2==NULL && node->c3==NULL && node->c4==NULL)		
-		fprintf(fp,"(%s, %s)\n",node->opr,node->value);
-	else
-		fprintf(fp,"%s\n",node->opr);
-        char new_prefix[1000];
-       	if(isLeft==0)
+void freeAST(AST *a)
+{
+	free(a->kind);
+	free(a->nkids);
+	free(a->val);
+	free(a->loc);
+	free(a->first);
+	free(a->kids);
+	memset(a, 0, sizeof(AST));
+}
+
+/* i'th child of node, 0 if it has none there */
+NODEID child(AST *ast, NODEID node, unsigned i)
+{
+	return i < ast->nkids[node] ? ast->kids[ast->first[node] + i] : 0;
+}
+
+NODEID newnode(COMPILATION *cc,int kind,NODEID c1,NODEID c2,NODEID c3,NODEID c4)
+{
+	AST *ast = &cc->ast;
+	NODEID c[4] = {c1, c2, c3, c4};
+	NODEID id;
+	int i, n = 4;
+	while(n > 0 && c[n-1] == 0)
+		n--;
+	id = addNode(ast, kind, 0, 0, n);
+	for(i=0;i<n;i++)
+		ast->kids[ast->first[id] + i] = c[i];
+	for(i=0;i<n;i++)
+		if(c[i] != 0)
 		{
-       		strcpy(new_prefix,prefix);
-       		strcat(new_prefix,"    ");
-       	}
-       	else
-   		{
-       		strcpy(new_prefix,prefix);
-       		strcat(new_prefix,"│   ");
-       	}
-     if(node->c1!=NULL && node->c2==NULL && node->c3==NULL && node->c4==NULL)
+			ast->loc[id] = ast->loc[c[i]];
+			break;
+		}
+	return id;
+}
+
+NODEID newleaf(COMPILATION *cc, int kind, int val, unsigned loc)
+{
+	return addNode(&cc->ast, kind, val, loc, 0);
+}
+
+/*
+	Statements finished inside open blocks, innermost block last. S is
+	left-recursive, so bison reduces each statement as soon as it ends
+	and its stack stays as deep as the nesting. An empty S records where
+	its block starts, and block() turns everything pushed since then into
+	one node.
+*/
+void pushStmt(COMPILATION *cc, NODEID stmt)
+{
+	if(cc->nstmt == cc->stmtcap)
 	{
-		printBT(new_prefix, node->c1, 0);
-        printBT(new_prefix, node->c2, 0);
-        printBT(new_prefix, node->c3, 0);
-        printBT(new_prefix, node->c4, 0);
-        return;
+		cc->stmtcap = cc->stmtcap ? cc->stmtcap*2 : 1024;
+		cc->stmts = (NODEID*)realloc(cc->stmts, cc->stmtcap*sizeof(NODEID));
 	}
-	if(node->c1!=NULL && node->c2!=NULL && node->c3==NULL && node->c4==NULL)
+	cc->stmts[cc->nstmt++] = stmt;
+}
+
+/* N_BLOCK of the statements pushed since mark, or no node for an empty block */
+NODEID block(COMPILATION *cc, unsigned mark)
+{
+	AST *ast = &cc->ast;
+	NODEID id;
+	unsigned n = cc->nstmt - mark;
+	if(n == 0)
+		return nptr;
+	id = addNode(ast, N_BLOCK, 0, ast->loc[cc->stmts[mark]], n);
+	memcpy(ast->kids + ast->first[id], cc->stmts + mark, n*sizeof(NODEID));
+	cc->nstmt = mark;
+	return id;
+}
+
+/* node for a binary or assignment operator; op is the interned operator */
+NODEID opnode(COMPILATION *cc, int op, NODEID c1, NODEID c2, NODEID c3)
+{
+	NODEID id = newnode(cc, N_OP, c1, c2, c3, 0);
+	cc->ast.val[id] = op;
+	return id;
+}
+
+void display(COMPILATION *cc, NODEID r)
+{
+	unsigned i;
+	if(r==0)
+		return;
+	if(cc->ast.nkids[r]==0)
 	{
-		printBT(new_prefix, node->c1, 1);
-        printBT(new_prefix, node->c2, 0);
-        printBT(new_prefix, node->c3, 0);
-        printBT(new_prefix, node->c4, 0);
-        return;
+		printf("(");
+		printf("%s\t%s)\n",nodeLabel(cc,r),nodeValue(cc,r));
 	}
-	if(node->c1!=NULL && node->c2!=NULL && node->c3!=NULL && node->c4==NULL)
+	else
+		printf("%s\n",nodeLabel(cc,r));
+	for(i=0;i<cc->ast.nkids[r];i++)
+		display(cc,child(&cc->ast,r,i));
+}
+
+/* AST.txt goes through one large buffer instead of an fprintf per fragment */
+#define OUTBUFSIZE (1<<20)
+
+typedef struct outbuf
+{
+	char *buf;
+	size_t len;
+	FILE *f;
+}OUTBUF;
+
+static void outWrite(OUTBUF *o, const char *s, size_t n)
+{
+	if(o->len + n > OUTBUFSIZE)
 	{
-		printBT(new_prefix, node->c1, 1);
-        printBT(new_prefix, node->c2, 1);
-        printBT(new_prefix, node->c3, 0);
-        printBT(new_prefix, node->c4, 0);
-        return;
-	}	
-	if(node->c1!=NULL && node->c2!=NULL && node->c3!=NULL && node->c4!=NULL)
+		fwrite(o->buf, 1, o->len, o->f);
+		o->len = 0;
+		if(n > OUTBUFSIZE)
+		{
+			fwrite(s, 1, n, o->f);
+			return;
+		}
+	}
+	memcpy(o->buf + o->len, s, n);
+	o->len += n;
+}
+
+static void outStr(OUTBUF *o, const char *s)
+{
+	outWrite(o, s, strlen(s));
+}
+
+static void outUnsigned(OUTBUF *o, unsigned v)
+{
+	char d[10];
+	int i = 10;
+	do
+		d[--i] = '0' + v%10;
+	while((v /= 10) != 0);
+	outWrite(o, d + i, 10 - i);
+}
+
+/* a node waiting to be printed: its prefix is the first plen bytes of the shared buffer */
+typedef struct printframe
+{
+	NODEID node;
+	unsigned plen;
+	int isLeft;
+}PRINTFRAME;
+
+/*
+	Writes the tree under root to f, one line per node, in preorder.
+	The traversal keeps its own stack and a single prefix buffer, so the
+	depth of the tree is limited only by memory. A node's prefix is its
+	parent's plus one column; siblings share the same bytes, and deeper
+	nodes only ever write past them. Children are printed only when none
+	is missing before the last one; that is how the four fixed child
+	slots were printed before.
+*/
+void printAST(COMPILATION *cc, FILE *f, NODEID root)
+{
+	AST *ast = &cc->ast;
+	OUTBUF o;
+	PRINTFRAME *stack, top;
+	unsigned nstack = 0, cap = 1024, pcap = 1024, plen;
+	char *prefix;
+	const char *step;
+	NODEID *kids;
+	int i, n;
+	if(root == 0)
+		return;
+	o.buf = (char*)malloc(OUTBUFSIZE);
+	o.len = 0;
+	o.f = f;
+	stack = (PRINTFRAME*)malloc(cap*sizeof(PRINTFRAME));
+	prefix = (char*)malloc(pcap);
+	stack[nstack].node = root;
+	stack[nstack].plen = 0;
+	stack[nstack].isLeft = 0;
+	nstack++;
+	while(nstack > 0)
 	{
-		printBT(new_prefix, node->c1, 1);
-        printBT(new_prefix, node->c2, 1);
-        printBT(new_prefix, node->c3, 1);
-        printBT(new_prefix, node->c4, 0);
-        return;
-	}	   
-  } 	
+		top = stack[--nstack];
+		outWrite(&o, prefix, top.plen);
+		outStr(&o, top.isLeft ? "├──" : "└──");
+		n = ast->nkids[top.node];
+		if(n == 0)
+		{
+			outStr(&o, "(");
+			outStr(&o, nodeLabel(cc, top.node));
+			outStr(&o, ", ");
+			outStr(&o, nodeValue(cc, top.node));
+			outStr(&o, ")");
+			if(cc->showloc)
+			{
+				unsigned col, line = offsetLine(&cc->lex.lines, ast->loc[top.node], &col);
+				outStr(&o, " ");
+				outUnsigned(&o, line);
+				outStr(&o, ":");
+				outUnsigned(&o, col);
+			}
+			outStr(&o, "\n");
+			continue;
+		}
+		outStr(&o, nodeLabel(cc, top.node));
+		outStr(&o, "\n");
+		kids = ast->kids + ast->first[top.node];
+		for(i=0;i<n;i++)
+			if(kids[i] == 0)
+				break;
+		if(i < n)
+			continue;
+		step = top.isLeft ? "│   " : "    ";
+		plen = top.plen + strlen(step);
+		if(plen > pcap)
+			prefix = (char*)realloc(prefix, pcap *= 2);
+		memcpy(prefix + top.plen, step, plen - top.plen);
+		if(nstack + n > cap)
+		{
+			while(nstack + n > cap)
+				cap *= 2;
+			stack = (PRINTFRAME*)realloc(stack, cap*sizeof(PRINTFRAME));
+		}
+		for(i=n-1;i>=0;i--)
+		{
+			stack[nstack].node = kids[i];
+			stack[nstack].plen = plen;
+			stack[nstack].isLeft = i < n-1;
+			nstack++;
+		}
+	}
+	fwrite(o.buf, 1, o.len, f);
+	free(o.buf);
+	free(stack);
+	free(prefix);
 }
 
+/* nodes on the longest path from root to a leaf; an explicit stack, like printAST() */
+unsigned astDepth(AST *ast, NODEID root)
+{
+	NODEID *stack, *kids;
+	unsigned *level;
+	unsigned nstack = 1, cap = 1024, depth = 0, d, i, n;
+	if(root == 0)
+		return 0;
+	stack = (NODEID*)malloc(cap*sizeof(NODEID));
+	level = (unsigned*)malloc(cap*sizeof(unsigned));
+	stack[0] = root;
+	level[0] = 1;
+	while(nstack > 0)
+	{
+		nstack--;
+		d = level[nstack];
+		if(d > depth)
+			depth = d;
+		n = ast->nkids[stack[nstack]];
+		kids = ast->kids + ast->first[stack[nstack]];
+		if(nstack + n > cap)
+		{
+			while(nstack + n > cap)
+				cap *= 2;
+			stack = (NODEID*)realloc(stack, cap*sizeof(NODEID));
+			level = (unsigned*)realloc(level, cap*sizeof(unsigned));
+		}
+		for(i=0;i<n;i++)
+			if(kids[i] != 0)
+			{
+				stack[nstack] = kids[i];
+				level[nstack++] = d + 1;
+			}
+	}
+	free(stack);
+	free(level);
+	return depth;
+}
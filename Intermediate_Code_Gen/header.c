@@ -1,3 +1,5 @@
+#include "tokval.h"
+#include "lexer.h"
 typedef struct tree
 {
 	char *opr;
@@ -12,23 +14,12 @@ typedef struct ast
 	TREE* root;
 }AST;
 
-typedef struct yacc
+/* value of an Expr: the operand to use and, for a plain name, its spelling */
+typedef struct exprval
 {
-	char* tr;
-	char* fal;
-	char* next;
-	int i;
-	float f;
-	char* v;
-	char* a;
-	char* code;
-	char* addr;
-	int scope;
-	int occur;
-	char *type;
-	char* val;
-	TREE *ptr;
-}YACC;
+	char *addr;
+	char *name;
+}EXPRVAL;
 
 /*
 typedef struct node{
@@ -58,8 +49,30 @@ typedef struct symlist{
 typedef struct node{
 	char* temp;
 	char* var;
-	struct node* next;
 }NODE;
+/*
+	The temporary last assigned to each name, in an open-addressing table.
+	Names and temporaries are interned, so they hash and compare by
+	pointer, and a lookup costs the same however long main() is.
+*/
 typedef struct list{
-	NODE* head;
+	NODE* slot;
+	unsigned nslot;		/* a power of two, or 0 before the first append() */
+	unsigned n;
 }LIST;
+
+/*
+	Everything one parse reads and writes. The parser is pure and gets
+	its COMPILATION from yyparse()'s arguments, so several files can be
+	translated at once on different threads.
+*/
+typedef struct compilation
+{
+	LEXER lex;
+	FILE *out;			/* icg.txt */
+	LIST *l;			/* the temporary holding each variable, see search() */
+	char *pp, *qq, *rr, *tt, *uu, *vv;	/* labels handed from one action to a later one */
+	int tn;				/* next temporary */
+	int ln;				/* next label */
+	int errors;
+}COMPILATION;
@@ -3,46 +3,66 @@
 	#include<string.h>
 	#include<stdlib.h>
 	#include<stdbool.h>
+	#include<stdint.h>
 	#include "header.c"			
-	#define YYSTYPE YACC
-	FILE *yyin;
-	FILE *fp;
-	int yylex();
 
-	void yyerror(const char *);
+	void yyerror(LEXER *lx, COMPILATION *cc, const char *);
+	void initCompilation(COMPILATION *cc);
+	void freeCompilation(COMPILATION *cc);
+	int compileSource(COMPILATION *cc);
 	
-	
-	
-	FILE *yyin;
-	int yylex();
-	
-	int i =0;
-	
-	char* newLabel(int *ln);
-	char* newTemp(int *tn);
-	int lbflag = 0;
-	int tn = 0;
-	int ln = 1;
-    int z;	
-    int ss=0;
-    NODE *a;
-    LIST *l;
+	char* newLabel(COMPILATION *cc);
+	char* newTemp(COMPILATION *cc);
+	char* numText(COMPILATION *cc, TOKVAL *t);
+	NUMVAL* numValue(LEXER *lx, int id);
+	int formatNumber(char *buf, size_t size, NUMVAL *v);
     void append(LIST *a,char *b,char *c);
     char* search(LIST* a,char *b);
-    char* pp;
-    char* qq;
-    char* rr;
-    char* tt;
-	char* uu;
-	char* vv;
+    int intern(INTERNPOOL *ip, const char *s, int len);
+    char* internStr(INTERNPOOL *ip, int id);
+    int tokenLogMode(char *s);
+    void openTokenLog(TOKLOG *tl, int mode);
+    void closeTokenLog(TOKLOG *tl);
+    int openTokenStream(LEXER *lx, char *path);
+    void closeTokenStream(LEXER *lx);
+    int openSource(LEXER *lx, char *path);
+    void closeSource(LEXER *lx);
+    int openReplay(LEXER *lx, char *tokpath, char *srcpath);
+    void closeReplay(LEXER *lx);
+    int openSourceParallel(LEXER *lx, char *path, int nthreads);
+    void initLexer(LEXER *lx);
+    void freeLexer(LEXER *lx);
 %}
-%token T_CLASS T_PUBLIC T_PRIVATE T_STATIC T_FINAL T_VOID T_INT T_CHAR T_DOUBLE T_IF T_ELSE T_NEW T_INC T_DEC T_LOGOR T_LOGAND T_OR T_AND T_EQ T_NEQ T_GTEQ T_LTEQ T_ADD T_SUB T_MUL T_DIV T_GT T_LT T_XOR T_MOD T_LS T_RS T_NUM T_ID T_STRING T_ARGS T_PRINT T_FOR T_MAIN T_ASSGN T_MULASSGN T_DIVASSGN T_MODASSGN T_ADDASSGN T_SUBASSGN T_ANDASSGN T_XORASSGN T_ORASSGN
+/* pure, like sym.y: the lexer and everything the actions keep are yyparse()'s arguments */
+%define api.pure full
+%param {LEXER *lx}
+%parse-param {COMPILATION *cc}
+%code provides
+{
+	int yylex(YYSTYPE *lval, LEXER *lx);
+}
+%union
+{
+	TOKVAL tok;		/* tokens */
+	char *s;		/* address of an expression's value, or an operator */
+	EXPRVAL e;		/* Expr */
+}
+%token <tok> T_CLASS T_PUBLIC T_PRIVATE T_STATIC T_FINAL T_VOID T_INT T_CHAR T_DOUBLE T_IF T_ELSE T_NEW T_INC T_DEC T_LOGOR T_LOGAND T_OR T_AND T_EQ T_NEQ T_GTEQ T_LTEQ T_ADD T_SUB T_MUL T_DIV T_GT T_LT T_XOR T_MOD T_LS T_RS T_NUM T_ID T_STRING T_ARGS T_PRINT T_FOR T_MAIN T_ASSGN T_MULASSGN T_DIVASSGN T_MODASSGN T_ADDASSGN T_SUBASSGN T_ANDASSGN T_XORASSGN T_ORASSGN
+%type <s> Assignment Assignment1 Assignment_operator UNREXPR
+%type <s> LOGICALOREXPR
+%type <e> Expr
+%left T_LOGOR
+%left T_LOGAND
+%left T_EQ T_NEQ
+%left T_LT T_GT T_LTEQ T_GTEQ
+%left T_ADD T_SUB
+%left T_MUL T_DIV T_MOD
 
 %%
 START:Modifier T_CLASS T_ID '{'Method_declaration'}';
 
 
-Method_declaration:Modifier Type T_MAIN'('Type'['']' T_ARGS')'{l=(LIST*)malloc(sizeof(LIST));l->head=NULL;}'{'S'}';
+Method_declaration:Modifier Type T_MAIN'('Type'['']' T_ARGS')'{cc->l=(LIST*)calloc(1,sizeof(LIST));}'{'S'}';
 
 Modifier:W1 W2;
 
@@ -52,152 +72,87 @@ W1:T_PUBLIC
 W2:T_STATIC
 	|;
 
-S:	Assignment';' S 
-	|IF
-	 ELSE 					{$$.code = (char*)malloc(sizeof(char)*100);
-							 sprintf($$.code,"%s:\n",qq);
-							 fprintf(fp,"%s",$$.code);}
-	 S
-	|	FOR
-		'{'S'}'								{	$$.code = (char*)malloc(sizeof(char)*100);
-												sprintf($$.code,"goto %s\n%s:\n",uu,rr);
-												fprintf(fp,"%s",$$.code);}
-		S
-	|Variable_declaration';' S
-	|Array_declaration';' S
-	|Array_initialisation';' S
-	|UNREXPR';'
+/* left-recursive, so the parser stack grows with nesting and not with the number of statements */
+S:	Statements
+	|Statements UNREXPR';';
+
+Statements:	Statements Assignment';'
+	|Statements IF
+	 ELSE 					{fprintf(cc->out,"%s:\n",cc->qq);}
+	|Statements	FOR
+		'{'S'}'								{fprintf(cc->out,"goto %s\n%s:\n",cc->uu,cc->rr);}
+	|Statements Variable_declaration';'
+	|Statements Array_declaration';'
+	|Statements Array_initialisation';'
 	|;
 
-IF:T_IF '('LOGICALOREXPR')' {$$.tr=newLabel(&ln);
-							$$.addr=newLabel(&ln);
-							pp=$$.addr;
-							$$.code = (char*)malloc(sizeof(char)*100);
-							sprintf($$.code,"if %s goto %s\ngoto %s\n%s:\n",$3.addr,$$.tr,$$.addr,$$.tr);
-							fprintf(fp,"%s",$$.code);} 
-	 '{'S'}'				{$$.tr=newLabel(&ln);
-							 qq=$$.tr;
-							 $$.code = (char*)malloc(sizeof(char)*100);
-							 sprintf($$.code,"goto %s\n",$$.tr);
-							 fprintf(fp,"%s",$$.code);} ;
-
-ELSE:	T_ELSE {$$.code = (char*)malloc(sizeof(char)*100);
-			sprintf($$.code,"%s:\n",pp);
-			fprintf(fp,"%s",$$.code);
-			} 
+IF:T_IF '('LOGICALOREXPR')' {char *t=newLabel(cc);
+							cc->pp=newLabel(cc);
+							fprintf(cc->out,"if %s goto %s\ngoto %s\n%s:\n",$3,t,cc->pp,t);} 
+	 '{'S'}'				{cc->qq=newLabel(cc);
+							 fprintf(cc->out,"goto %s\n",cc->qq);} ;
+
+ELSE:	T_ELSE {fprintf(cc->out,"%s:\n",cc->pp);} 
 	'{'S'}'
-	|		{$$.code = (char*)malloc(sizeof(char)*100);
-			 sprintf($$.code,"%s:\n",pp);
-			 fprintf(fp,"%s",$$.code);};
-
-FOR:	T_FOR'('';'';'')' 						{	uu=newLabel(&ln);
-													rr=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"%s:\n",uu);
-													fprintf(fp,"%s",$$.code);}
-		|T_FOR'('Assignment';'';'')'				{	uu=newLabel(&ln);
-													rr=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"%s:\n",uu);
-													fprintf(fp,"%s",$$.code);}
-		|T_FOR'('Assignment';' Print LOGICALOREXPR';'')'	{	$$.tr=newLabel(&ln);
-													$$.addr=newLabel(&ln);
-													rr=$$.addr;
-													vv=$$.tr;
-													uu=tt;
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"if %s goto %s\ngoto %s\n%s:\n",$5.addr,$$.tr,$$.addr,vv);
-													fprintf(fp,"%s",$$.code);} 
-		|T_FOR'('Assignment';'';'					{	uu=newLabel(&ln);
-													tt=newLabel(&ln);
-													rr=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"goto %s\n%s:\n",tt,uu);
-													fprintf(fp,"%s",$$.code);} 
-			UNREXPR')'								{	$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"%s:\n",tt);
-													fprintf(fp,"%s",$$.code);
-												}
-		|T_FOR'('';'Print LOGICALOREXPR';'')'		{	$$.tr=newLabel(&ln);
-													$$.addr=newLabel(&ln);
-													rr=$$.addr;
-													vv=$$.tr;
-													uu=tt;
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"if %s goto %s\ngoto %s\n%s:\n",$5.addr,$$.tr,$$.addr,vv);
-													fprintf(fp,"%s",$$.code);} 
-		|T_FOR'('';'Print LOGICALOREXPR';'			{	$$.tr=newLabel(&ln);
-													$$.addr=newLabel(&ln);
-													rr=$$.addr;
-													vv=$$.tr;
-													uu=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"if %s goto %s\ngoto %s\n%s:\n",$5.addr,$$.tr,$$.addr,uu);
-													fprintf(fp,"%s",$$.code);} 
-			UNREXPR')'								{	$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"goto %s\n%s:\n",tt,vv);
-													fprintf(fp,"%s",$$.code);
-												}
-		|T_FOR'('Assignment';'Print LOGICALOREXPR';'	{	$$.tr=newLabel(&ln);
-													$$.addr=newLabel(&ln);
-													rr=$$.addr;
-													vv=$$.tr;
-													uu=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"if %s goto %s\ngoto %s\n%s:\n",$5.addr,$$.tr,$$.addr,uu);
-													fprintf(fp,"%s",$$.code);} 
-		UNREXPR')' 									{	$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"goto %s\n%s:\n",tt,vv);
-													fprintf(fp,"%s",$$.code);
-												}	
-		|T_FOR'('';'';'							{	uu=newLabel(&ln);
-													tt=newLabel(&ln);
-													rr=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"goto %s\n%s:\n",tt,uu);
-													fprintf(fp,"%s",$$.code);} 
-			UNREXPR')'								{	$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"%s:\n",tt);
-													fprintf(fp,"%s",$$.code);
-												};
-Print:											{	tt=newLabel(&ln);
-													$$.code = (char*)malloc(sizeof(char)*100);
-													sprintf($$.code,"%s:\n",tt);
-													fprintf(fp,"%s",$$.code);
-												};
-
-UNREXPR:	Expr T_INC					{$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s \n%s = %s\n",$$.addr,$1.addr,strdup(" + 1"),$1.addr,$$.addr);
-								fprintf(fp,"%s",$$.code);}
-	|Expr T_DEC					{$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s \n%s = %s\n",$$.addr,$1.addr,strdup(" - 1"),$1.addr,$$.addr);
-								fprintf(fp,"%s",$$.code);}
-	|T_INC Expr					{$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s \n%s = %s\n",$$.addr,$2.addr,strdup(" + 1"),$2.addr,$$.addr);
-								fprintf(fp,"%s",$$.code);}
-	|T_DEC Expr					{$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s \n%s = %s\n",$$.addr,$2.addr,strdup(" - 1"),$2.addr,$$.addr);
-								fprintf(fp,"%s",$$.code);};
-
-Variable_declaration:Type Expr T_ASSGN LOGICALOREXPR X {append(l,$4.addr,$2.addr);
-																		$$.code = (char*)malloc(sizeof(char)*100);
-																		sprintf($$.code,"%s = %s\n",$2.addr,$4.addr);
-																		fprintf(fp,"%s",$$.code);};
+	|		{fprintf(cc->out,"%s:\n",cc->pp);};
+
+FOR:	T_FOR'('';'';'')' 						{	cc->uu=newLabel(cc);
+													cc->rr=newLabel(cc);
+													fprintf(cc->out,"%s:\n",cc->uu);}
+		|T_FOR'('Assignment';'';'')'				{	cc->uu=newLabel(cc);
+													cc->rr=newLabel(cc);
+													fprintf(cc->out,"%s:\n",cc->uu);}
+		|T_FOR'('Assignment';' Print LOGICALOREXPR';'')'	{	cc->vv=newLabel(cc);
+													cc->rr=newLabel(cc);
+													cc->uu=cc->tt;
+													fprintf(cc->out,"if %s goto %s\ngoto %s\n%s:\n",$6,cc->vv,cc->rr,cc->vv);} 
+		|T_FOR'('Assignment';'';'					{	cc->uu=newLabel(cc);
+													cc->tt=newLabel(cc);
+													cc->rr=newLabel(cc);
+													fprintf(cc->out,"goto %s\n%s:\n",cc->tt,cc->uu);} 
+			UNREXPR')'								{	fprintf(cc->out,"%s:\n",cc->tt);}
+		|T_FOR'('';'Print LOGICALOREXPR';'')'		{	cc->vv=newLabel(cc);
+													cc->rr=newLabel(cc);
+													cc->uu=cc->tt;
+													fprintf(cc->out,"if %s goto %s\ngoto %s\n%s:\n",$5,cc->vv,cc->rr,cc->vv);} 
+		|T_FOR'('';'Print LOGICALOREXPR';'			{	cc->vv=newLabel(cc);
+													cc->rr=newLabel(cc);
+													cc->uu=newLabel(cc);
+													fprintf(cc->out,"if %s goto %s\ngoto %s\n%s:\n",$5,cc->vv,cc->rr,cc->uu);} 
+			UNREXPR')'								{	fprintf(cc->out,"goto %s\n%s:\n",cc->tt,cc->vv);}
+		|T_FOR'('Assignment';'Print LOGICALOREXPR';'	{	cc->vv=newLabel(cc);
+													cc->rr=newLabel(cc);
+													cc->uu=newLabel(cc);
+													fprintf(cc->out,"if %s goto %s\ngoto %s\n%s:\n",$6,cc->vv,cc->rr,cc->uu);} 
+		UNREXPR')' 									{	fprintf(cc->out,"goto %s\n%s:\n",cc->tt,cc->vv);}	
+		|T_FOR'('';'';'							{	cc->uu=newLabel(cc);
+													cc->tt=newLabel(cc);
+													cc->rr=newLabel(cc);
+													fprintf(cc->out,"goto %s\n%s:\n",cc->tt,cc->uu);} 
+			UNREXPR')'								{	fprintf(cc->out,"%s:\n",cc->tt);};
+Print:											{	cc->tt=newLabel(cc);
+													fprintf(cc->out,"%s:\n",cc->tt);};
+
+UNREXPR:	Expr T_INC					{$$ = newTemp(cc);
+								fprintf(cc->out,"%s = %s  + 1 \n%s = %s\n",$$,$1.addr,$1.addr,$$);}
+	|Expr T_DEC					{$$ = newTemp(cc);
+								fprintf(cc->out,"%s = %s  - 1 \n%s = %s\n",$$,$1.addr,$1.addr,$$);}
+	|T_INC Expr					{$$ = newTemp(cc);
+								fprintf(cc->out,"%s = %s  + 1 \n%s = %s\n",$$,$2.addr,$2.addr,$$);}
+	|T_DEC Expr					{$$ = newTemp(cc);
+								fprintf(cc->out,"%s = %s  - 1 \n%s = %s\n",$$,$2.addr,$2.addr,$$);};
+
+Variable_declaration:Type Expr T_ASSGN LOGICALOREXPR X {append(cc->l,$4,$2.addr);
+																		fprintf(cc->out,"%s = %s\n",$2.addr,$4);};
 		|Type Expr X';';
 
 X:		','Assignment1 X 
 		|','T_ID X 
 		|;
 
-Assignment1:Expr Assignment_operator LOGICALOREXPR {append(l,$3.addr,$$.addr);
-										$$.addr=strdup($1.v);
-										$$.code = (char*)malloc(sizeof(char)*200);
-										sprintf($$.code,"%s = %s\n",$$.addr,$3.addr);
-										fprintf(fp,"%s",$$.code);} ;
+Assignment1:Expr Assignment_operator LOGICALOREXPR {append(cc->l,$3,$1.addr);
+										$$=$1.name;
+										fprintf(cc->out,"%s = %s\n",$$,$3);} ;
 
 Array_declaration:Type Brackets Expr 
 		|Type Expr Brackets ;
@@ -231,149 +186,221 @@ Type:	T_INT
 		|T_STRING 
 		|T_VOID ;
 
-Assignment:Expr Assignment_operator LOGICALOREXPR {append(l,$3.addr,$$.addr);
-										$$.addr=strdup($1.v);
-										$$.code = (char*)malloc(sizeof(char)*200);
-										sprintf($$.code,"%s = %s\n",$$.addr,$3.addr);
-										fprintf(fp,"%s",$$.code);} ;
-
-Assignment_operator:T_ASSGN {$$.code = strdup("=");}
-		|T_ADD {$$.code = strdup("+");} 
-		|T_SUB {$$.code = strdup("-");} 
-		|T_MUL {$$.code = strdup("*");} 
-		|T_DIV {$$.code = strdup("/");}  
-		|T_AND {$$.code = strdup("&");} 
-		|T_OR {$$.code = strdup("|");} 
-		|T_XOR {$$.code = strdup("^");} 
-		|T_MOD {$$.code = strdup("%");};
-
-LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALANDEXPR {$$.addr = newTemp(&tn);
-													$$.code = (char*)malloc(sizeof(char)*100); 
-													sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("||"),$3.addr);
-													fprintf(fp,"%s",$$.code);}
-		|LOGICALANDEXPR;
-
-LOGICALANDEXPR: LOGICALANDEXPR T_LOGAND EQUALITYEXPR {$$.addr = newTemp(&tn);
-														$$.code = (char*)malloc(sizeof(char)*100); 
-														sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("&&"),$3.addr);
-														fprintf(fp,"%s",$$.code);}
-		|EQUALITYEXPR;
-
-EQUALITYEXPR: EQUALITYEXPR T_EQ RELEXPR {$$.addr = newTemp(&tn);
-										$$.code = (char*)malloc(sizeof(char)*100); 
-										sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("=="),$3.addr);
-										fprintf(fp,"%s",$$.code);}
-		| EQUALITYEXPR T_NEQ RELEXPR {$$.addr = newTemp(&tn);
-										$$.code = (char*)malloc(sizeof(char)*100); 
-										sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("!="),$3.addr);
-										fprintf(fp,"%s",$$.code);}
-		|RELEXPR;
-
-RELEXPR:  RELEXPR T_LT ADDEXPR {$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("<"),$3.addr);
-								fprintf(fp,"%s",$$.code);}
-		| RELEXPR T_GT ADDEXPR {$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup(">"),$3.addr);
-								fprintf(fp,"%s",$$.code);}
-		| RELEXPR T_LTEQ ADDEXPR {$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("<="),$3.addr);
-								fprintf(fp,"%s",$$.code);}
-		| RELEXPR T_GTEQ ADDEXPR {$$.addr = newTemp(&tn);
-								$$.code = (char*)malloc(sizeof(char)*100); 
-								sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup(">="),$3.addr);
-								fprintf(fp,"%s",$$.code);}
-		|ADDEXPR;
-
-ADDEXPR:  ADDEXPR T_ADD MULTEXPR {$$.addr = newTemp(&tn);
-									$$.code = (char*)malloc(sizeof(char)*100); 
-									sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("+"),$3.addr);
-									fprintf(fp,"%s",$$.code);}
-		| ADDEXPR T_SUB MULTEXPR {$$.addr = newTemp(&tn);
-									$$.code = (char*)malloc(sizeof(char)*100); 
-									sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("-"),$3.addr);
-									fprintf(fp,"%s",$$.code);}
-		|MULTEXPR;
-
-MULTEXPR: MULTEXPR T_MUL Expr {$$.addr = newTemp(&tn);
-									$$.code = (char*)malloc(sizeof(char)*100); 
-									sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("*"),$3.addr);
-									fprintf(fp,"%s",$$.code);}
-		| MULTEXPR T_DIV Expr {$$.addr = newTemp(&tn);
-									$$.code = (char*)malloc(sizeof(char)*100); 
-									sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("/"),$3.addr);
-									fprintf(fp,"%s",$$.code);}
-		| MULTEXPR T_MOD Expr {$$.addr = newTemp(&tn);
-									$$.code = (char*)malloc(sizeof(char)*100); 
-									sprintf($$.code,"%s = %s %s %s\n",$$.addr,$1.addr,strdup("%"),$3.addr);
-									fprintf(fp,"%s",$$.code);}
-		| Expr;
-
-
-Expr:	'('LOGICALOREXPR')' 
-		|T_NUM {$$.addr = strdup($1.v);}
-		|T_ID {$$.addr = search(l,$1.v);};
+Assignment:Expr Assignment_operator LOGICALOREXPR {append(cc->l,$3,$1.addr);
+										$$=$1.name;
+										fprintf(cc->out,"%s = %s\n",$$,$3);} ;
+
+Assignment_operator:T_ASSGN {$$ = "=";}
+		|T_ADD {$$ = "+";} 
+		|T_SUB {$$ = "-";} 
+		|T_MUL {$$ = "*";} 
+		|T_DIV {$$ = "/";}  
+		|T_AND {$$ = "&";} 
+		|T_OR {$$ = "|";} 
+		|T_XOR {$$ = "^";} 
+		|T_MOD {$$ = "%";};
+
+/* one rule per binary operator, ranked by the %left lines above */
+LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s || %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_LOGAND LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s && %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_EQ LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s == %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_NEQ LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s != %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_LT LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s < %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_GT LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s > %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_LTEQ LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s <= %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_GTEQ LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s >= %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_ADD LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s + %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_SUB LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s - %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_MUL LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s * %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_DIV LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s / %s\n",$$,$1,$3);}
+		| LOGICALOREXPR T_MOD LOGICALOREXPR {$$ = newTemp(cc);
+						fprintf(cc->out,"%s = %s %% %s\n",$$,$1,$3);}
+		| Expr {$$ = $1.addr;};
+
+Expr:	'('LOGICALOREXPR')' {$$.addr = $$.name = $2;}
+		|T_NUM {$$.addr = $$.name = numText(cc,&$1);}
+		|T_ID {$$.addr = search(cc->l,$1.v); $$.name = $1.v;};
 
 %%
-char* newLabel(int *ln)
+/* labels are interned like temporaries, so the pool owns them and any number fits */
+char* newLabel(COMPILATION *cc)
+{
+	char s[16];
+	int n = sprintf(s,"L%d",cc->ln);
+	cc->ln++;
+	return internStr(&cc->lex.names, intern(&cc->lex.names, s, n));
+}
+/*
+	A literal as three-address code: its decoded value (numlit.c) in the
+	form the optimizer's lexer reads back, so 007 becomes 7 and 2.50
+	becomes 2.5. One that overflowed keeps its spelling.
+*/
+char* numText(COMPILATION *cc, TOKVAL *t)
 {
-	char *s = (char*)malloc(4*sizeof(char));
-	sprintf(s,"L%d",*ln);
-	(*ln)++;
-	return s;
+	char s[NUM_MAXTEXT];
+	NUMVAL *v = numValue(&cc->lex, t->id);
+	int n;
+	if(v->overflow)
+		return t->v;
+	n = formatNumber(s, sizeof(s), v);
+	return internStr(&cc->lex.names, intern(&cc->lex.names, s, n));
 }
-char* newTemp(int *tn)
+/* temporaries are interned like identifiers so search() can compare pointers */
+char* newTemp(COMPILATION *cc)
 {
-	char *s = (char*)malloc(4*sizeof(char));
-	sprintf(s,"T%d",*tn);
-	(*tn)++;
-	return s;
+	char s[16];
+	int n = sprintf(s,"T%d",cc->tn);
+	cc->tn++;
+	return internStr(&cc->lex.names, intern(&cc->lex.names, s, n));
 }
 
 
-void append(LIST *a,char *b,char *c)
+/* the slot that holds var, or the empty one where it would go */
+static NODE* listSlot(LIST *a, char *var)
 {
-    if(atoi(b) || strcmp(b,"0")==0)
-        return;
-    else
-    {
-        NODE *p=(NODE*)malloc(sizeof(NODE));
-        NODE *q=NULL;
-        p->temp=b;
-        p->var=c;
-        p->next=a->head;
-        a->head=p;
-    }
+	unsigned j = (unsigned)(((uintptr_t)var >> 3) * 2654435761u) & (a->nslot-1);
+	while(a->slot[j].var != NULL && a->slot[j].var != var)
+		j = (j+1) & (a->nslot-1);
+	return &a->slot[j];
+}
 
+static void listGrow(LIST *a)
+{
+	NODE *old = a->slot;
+	unsigned i, n = a->nslot;
+	a->nslot = n ? n*2 : 1024;
+	a->slot = (NODE*)calloc(a->nslot, sizeof(NODE));
+	for(i=0;i<n;i++)
+		if(old[i].var != NULL)
+			*listSlot(a, old[i].var) = old[i];
+	free(old);
+}
+
+void append(LIST *a,char *b,char *c)
+{
+	NODE *p;
+	if(atoi(b) || strcmp(b,"0")==0)
+		return;
+	if(a->n*2 >= a->nslot)
+		listGrow(a);
+	p = listSlot(a, c);
+	if(p->var == NULL)
+		a->n++;
+	p->var = c;
+	p->temp = b;
 }
 char* search(LIST* a,char *b)
 {
-    NODE* c=a->head;
-    while(c!=NULL && strcmp(c->var,b))
-        c=c->next;
-    if(c==NULL)
-        return b;
-    else
-        return c->temp;
+	NODE *c;
+	if(a->nslot == 0)
+		return b;
+	c = listSlot(a, b);
+	return c->var == NULL ? b : c->temp;
+}
+
+
+void yyerror(LEXER *lx, COMPILATION *cc, const char *s)
+{
+	(void)lx;
+	(void)s;
+	cc->errors++;
 }
 
+void initCompilation(COMPILATION *cc)
+{
+	memset(cc, 0, sizeof(COMPILATION));
+	initLexer(&cc->lex);
+	cc->ln = 1;
+}
 
-void yyerror(const char *s)
+/* frees the variable list and the lexer; cc->out and the sources are closed before */
+void freeCompilation(COMPILATION *cc)
 {
-	yynerrs+=1;
+	if(cc->l != NULL)
+	{
+		free(cc->l->slot);
+		free(cc->l);
+	}
+	freeLexer(&cc->lex);
+	initCompilation(cc);
 }
+
+/* what compileSource() writes to cc->out; main() calls it icg.txt */
+const char outputFile[] = "icg.txt";
+
+/*
+	Translates the source opened in cc->lex, writing three-address code
+	to cc->out as it parses. Returns 0 on success. main() and the batch
+	driver (Lexer/batch.c) both compile through it.
+*/
+int compileSource(COMPILATION *cc)
+{
+	return yyparse(&cc->lex, cc) == 0 ? 0 : -1;
+}
+
 int main(int argc, char* argv[])
 {
-    
-	yyin = fopen(argv[1], "r");
-	fp = fopen("icg.txt","w");
+	COMPILATION cc;
+	int i, ok, tokmode = 2;
+	char *replayfile = NULL;
+	int jobs = 0;
 	int flag = 1;
-	if(!yyparse())
+	initCompilation(&cc);
+	for(i=2;i<argc;i++)
+		if(strncmp(argv[i],"--tokens=",9)==0)
+		{
+			if((tokmode = tokenLogMode(argv[i]+9)) < 0)
+				break;
+		}
+		else if(strncmp(argv[i],"--tokbin=",9)==0)
+			openTokenStream(&cc.lex, argv[i]+9);
+		else if(strncmp(argv[i],"--replay=",9)==0)
+			replayfile = argv[i]+9;
+		else if(strncmp(argv[i],"--jobs=",7)==0)
+			jobs = atoi(argv[i]+7);
+	if(argc < 2 || tokmode < 0)
+	{
+		printf("usage: %s file [--tokens=off|summary|full] ...\n", argv[0]);
+		return 1;
+	}
+	openTokenLog(&cc.lex.log, tokmode);
+	if(replayfile != NULL)
+	{
+		if(openReplay(&cc.lex, replayfile, argv[1]) != 0)
+		{
+			printf("cannot replay %s\n", replayfile);
+			return 1;
+		}
+	}
+	else if((jobs > 0 ? openSourceParallel(&cc.lex, argv[1], jobs) : openSource(&cc.lex, argv[1])) != 0)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	cc.out = fopen(outputFile,"w");
+	ok = compileSource(&cc) == 0;
+	fclose(cc.out);
+	closeTokenLog(&cc.lex.log);
+	closeTokenStream(&cc.lex);
+	closeReplay(&cc.lex);
+	closeSource(&cc.lex);
+	if(ok)
 			{printf("Parsing successful \n");flag = 0;}
 		else
 			{printf("Unsuccessful \n");}
+	freeCompilation(&cc);
 	return flag;
 }
 
@@ -0,0 +1,367 @@
+/*
+	Batch compiler: runs one phase over many files in one process.
+	Instead of starting ./a.out once per file, each file gets its own
+	COMPILATION (the parsers are pure, see README) and the files are
+	spread over a pool of threads. Like parsebench.c it links against a
+	phase's parser, whose main() is renamed, and compiles each file with
+	the phase's compileSource(). Build it from the AST or ICG folder
+	after yacc:
+		gcc -O2 -I. -I../Lexer -pthread -Dmain=phase_main ../Lexer/batch.c ../Lexer/hlex.c y.tab.c -o batch
+
+	usage: ./batch [-j threads] [-o dir] [-v] file|dir|@list ...
+	A directory stands for the .java files directly inside it, in name
+	order; @list reads one path per line from list. The output of
+	Foo.java is written to Foo.AST.txt (Foo.icg.txt in the ICG phase),
+	next to the input or in dir with -o. Inputs that would share an
+	output, such as a/Foo.java and b/Foo.java with -o, are refused before
+	anything is compiled. Each file is compiled on its own,
+	so its output does not depend on the threads or on the other files.
+	Token logs are not written. Failures are listed in input order, -v
+	lists every file, and the last line gives the aggregate throughput.
+
+	Scheduling is work stealing. Worker i starts with the i'th
+	contiguous range of the file list and takes files from its front.
+	A worker whose range is empty takes the back half of another's. A
+	range is one 64-bit word (next file in the high half, end in the low
+	half), so the owner and a thief agree through a compare-and-swap and
+	no lock is taken.
+*/
+#undef main
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "header.c"
+#include "y.tab.h"
+
+int openSource(LEXER *lx, char *path);
+void closeSource(LEXER *lx);
+void initCompilation(COMPILATION *cc);
+void freeCompilation(COMPILATION *cc);
+int compileSource(COMPILATION *cc);
+extern const char outputFile[];
+
+#define BATCH_OK 0
+#define BATCH_FAIL 1		/* did not parse */
+#define BATCH_NOFILE 2		/* input or output could not be opened */
+
+typedef struct batchfile
+{
+	char *path;
+	char *out;
+	size_t size;
+	int status;
+}BATCHFILE;
+
+typedef struct worker
+{
+	uint64_t range;		/* next file << 32 | end */
+	struct batch *b;
+	int id;
+	long files;
+	long steals;
+}WORKER;
+
+typedef struct batch
+{
+	BATCHFILE *file;
+	int nfile;
+	int cap;
+	WORKER *w;
+	int nworker;
+}BATCH;
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void addFile(BATCH *b, const char *path)
+{
+	if(b->nfile == b->cap)
+	{
+		b->cap = b->cap ? b->cap*2 : 256;
+		b->file = (BATCHFILE*)realloc(b->file, b->cap*sizeof(BATCHFILE));
+	}
+	memset(&b->file[b->nfile], 0, sizeof(BATCHFILE));
+	b->file[b->nfile++].path = strdup(path);
+}
+
+static int byName(const void *a, const void *b)
+{
+	return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/* adds the .java files directly inside dir, sorted so the order does not depend on the file system */
+static int addDir(BATCH *b, const char *dir)
+{
+	DIR *d = opendir(dir);
+	struct dirent *e;
+	char **name = NULL, *path;
+	int n = 0, cap = 0, i;
+	size_t len;
+	if(d == NULL)
+		return -1;
+	while((e = readdir(d)) != NULL)
+	{
+		len = strlen(e->d_name);
+		if(len <= 5 || strcmp(e->d_name + len - 5, ".java") != 0)
+			continue;
+		if(n == cap)
+			name = (char**)realloc(name, (cap = cap ? cap*2 : 256)*sizeof(char*));
+		name[n++] = strdup(e->d_name);
+	}
+	closedir(d);
+	qsort(name, n, sizeof(char*), byName);
+	for(i=0;i<n;i++)
+	{
+		path = (char*)malloc(strlen(dir) + strlen(name[i]) + 2);
+		sprintf(path, "%s/%s", dir, name[i]);
+		addFile(b, path);
+		free(path);
+		free(name[i]);
+	}
+	free(name);
+	return 0;
+}
+
+/* adds the paths in list, one per line */
+static int addList(BATCH *b, const char *list)
+{
+	FILE *f = fopen(list, "r");
+	char line[4096];
+	size_t len;
+	if(f == NULL)
+		return -1;
+	while(fgets(line, sizeof(line), f) != NULL)
+	{
+		len = strcspn(line, "\r\n");
+		line[len] = 0;
+		if(len > 0)
+			addFile(b, line);
+	}
+	fclose(f);
+	return 0;
+}
+
+/*
+	Reports every output path that two inputs share, as a/Foo.java and
+	b/Foo.java do under -o dir; their threads would write one file at
+	once. Returns how many there are.
+*/
+static int sameOutputs(BATCH *b)
+{
+	char **out = (char**)malloc((unsigned)b->nfile * sizeof(char*));
+	int i, n = 0;
+	for(i=0;i<b->nfile;i++)
+		out[i] = b->file[i].out;
+	qsort(out, b->nfile, sizeof(char*), byName);
+	for(i=1;i<b->nfile;i++)
+		if(strcmp(out[i-1], out[i]) == 0 && (i < 2 || strcmp(out[i-2], out[i]) != 0))
+		{
+			fprintf(stderr, "%s: written by more than one input\n", out[i]);
+			n++;
+		}
+	free(out);
+	return n;
+}
+
+/* Foo.java -> [dir/]Foo.<outputFile>, beside the input without dir */
+static char* outputPath(const char *path, const char *dir)
+{
+	const char *base = dir != NULL && strrchr(path, '/') != NULL ? strrchr(path, '/') + 1 : path;
+	size_t len = strlen(base);
+	char *s;
+	if(len > 5 && strcmp(base + len - 5, ".java") == 0)
+		len -= 5;
+	s = (char*)malloc((dir ? strlen(dir) + 1 : 0) + len + strlen(outputFile) + 2);
+	if(dir != NULL)
+		sprintf(s, "%s/%.*s.%s", dir, (int)len, base, outputFile);
+	else
+		sprintf(s, "%.*s.%s", (int)len, base, outputFile);
+	return s;
+}
+
+static void compileFile(BATCHFILE *f)
+{
+	COMPILATION cc;
+	struct stat st;
+	f->size = stat(f->path, &st) == 0 ? st.st_size : 0;
+	initCompilation(&cc);
+	cc.lex.log.mode = TOKLOG_OFF;
+	if(openSource(&cc.lex, f->path) != 0 || (cc.out = fopen(f->out, "w")) == NULL)
+	{
+		closeSource(&cc.lex);
+		freeCompilation(&cc);
+		f->status = BATCH_NOFILE;
+		return;
+	}
+	f->status = compileSource(&cc) == 0 ? BATCH_OK : BATCH_FAIL;
+	fclose(cc.out);
+	closeSource(&cc.lex);
+	freeCompilation(&cc);
+}
+
+/* the next file of w's own range, or -1 when it is empty */
+static int takeFile(WORKER *w)
+{
+	uint64_t r = __atomic_load_n(&w->range, __ATOMIC_ACQUIRE);
+	uint32_t lo, hi;
+	for(;;)
+	{
+		lo = r >> 32;
+		hi = (uint32_t)r;
+		if(lo >= hi)
+			return -1;
+		if(__atomic_compare_exchange_n(&w->range, &r, (uint64_t)(lo+1) << 32 | hi, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return lo;
+	}
+}
+
+/*
+	Moves the back half of some other worker's range to w, whose own
+	range is empty so no thief touches it. Returns 0 when every range
+	was seen empty. A file a thief has taken but not yet published is
+	compiled by that thief, so none is lost.
+*/
+static int steal(WORKER *w)
+{
+	BATCH *b = w->b;
+	WORKER *v;
+	uint64_t r;
+	uint32_t lo, hi, mid;
+	int i;
+	for(i=1;i<b->nworker;i++)
+	{
+		v = &b->w[(w->id + i) % b->nworker];
+		r = __atomic_load_n(&v->range, __ATOMIC_ACQUIRE);
+		for(;;)
+		{
+			lo = r >> 32;
+			hi = (uint32_t)r;
+			if(lo >= hi)
+				break;
+			mid = lo + (hi - lo) / 2;
+			if(__atomic_compare_exchange_n(&v->range, &r, (uint64_t)lo << 32 | mid, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			{
+				__atomic_store_n(&w->range, (uint64_t)mid << 32 | hi, __ATOMIC_RELEASE);
+				w->steals++;
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static void* batchWorker(void *arg)
+{
+	WORKER *w = (WORKER*)arg;
+	int i;
+	for(;;)
+	{
+		while((i = takeFile(w)) >= 0)
+		{
+			compileFile(&w->b->file[i]);
+			w->files++;
+		}
+		if(!steal(w))
+			return NULL;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BATCH b;
+	pthread_t *tid;
+	char *outdir = NULL;
+	int i, nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN), started, verbose = 0;
+	long ok = 0, fail = 0, steals = 0;
+	size_t bytes = 0;
+	double t0, t;
+	memset(&b, 0, sizeof(b));
+	for(i=1;i<argc;i++)
+		if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+			nthreads = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-o") == 0 && i+1 < argc)
+			outdir = argv[++i];
+		else if(strcmp(argv[i], "-v") == 0)
+			verbose = 1;
+		else if(argv[i][0] == '@')
+		{
+			if(addList(&b, argv[i]+1) != 0)
+				fprintf(stderr, "cannot read %s\n", argv[i]+1);
+		}
+		else
+		{
+			struct stat st;
+			if(stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode))
+				addDir(&b, argv[i]);
+			else
+				addFile(&b, argv[i]);
+		}
+	if(b.nfile == 0)
+	{
+		printf("usage: %s [-j threads] [-o dir] [-v] file|dir|@list ...\n", argv[0]);
+		return 1;
+	}
+	if(nthreads < 1)
+		nthreads = 1;
+	if(nthreads > b.nfile)
+		nthreads = b.nfile;
+	for(i=0;i<b.nfile;i++)
+		b.file[i].out = outputPath(b.file[i].path, outdir);
+	if(sameOutputs(&b) != 0)
+		return 1;
+	b.nworker = nthreads;
+	b.w = (WORKER*)calloc(nthreads, sizeof(WORKER));
+	for(i=0;i<nthreads;i++)
+	{
+		b.w[i].b = &b;
+		b.w[i].id = i;
+		b.w[i].range = (uint64_t)((long)b.nfile * i / nthreads) << 32 | (uint32_t)((long)b.nfile * (i+1) / nthreads);
+	}
+	tid = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
+	t0 = now();
+	/* the ranges of workers that could not be started are stolen by the others, worker 0 at least */
+	for(started=1;started<nthreads;started++)
+		if(pthread_create(&tid[started], NULL, batchWorker, &b.w[started]) != 0)
+		{
+			fprintf(stderr, "could only start %d threads\n", started);
+			break;
+		}
+	batchWorker(&b.w[0]);
+	for(i=1;i<started;i++)
+		pthread_join(tid[i], NULL);
+	t = now() - t0;
+	for(i=0;i<b.nfile;i++)
+	{
+		bytes += b.file[i].size;
+		if(b.file[i].status == BATCH_OK)
+			ok++;
+		else
+			fail++;
+		if(verbose || b.file[i].status != BATCH_OK)
+			printf("%s: %s\n", b.file[i].path, b.file[i].status == BATCH_OK ? "ok" :
+				b.file[i].status == BATCH_FAIL ? "Unsuccessful" : "cannot open");
+	}
+	for(i=0;i<nthreads;i++)
+		steals += b.w[i].steals;
+	printf("%d files, %ld ok, %ld failed, %zu bytes, %d threads, %ld steals, %.3f s, %.0f files/s, %.1f MB/s\n",
+		b.nfile, ok, fail, bytes, started, steals, t, b.nfile / t, bytes / t / 1e6);
+	for(i=0;i<b.nfile;i++)
+	{
+		free(b.file[i].path);
+		free(b.file[i].out);
+	}
+	free(b.file);
+	free(b.w);
+	free(tid);
+	return fail != 0;
+}
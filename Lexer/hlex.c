@@ -0,0 +1,109 @@
+/*
+	Hand-written replacement for the flex scanner generated from sym.l.
+	It accepts the same language, returns the same y.tab.h token codes and
+	fills in the token value, tokens.txt and the --tokbin stream exactly
+	like sym.l.
+
+	Like sym.l it is reentrant: all of its state is in the LEXER (lexer.h)
+	the parser passes to yylex(), so each compilation has its own.
+
+	Build with it instead of lex.yy.c, from a phase folder:
+		yacc -vd sym.y
+		gcc -I. -I../Lexer -pthread ../Lexer/hlex.c y.tab.c
+
+	The scanner works on the whole source in memory (mapped through
+	srcmap.c, or read in one go for pipes). The scanning itself is in
+	hscan.c: a character class table picks the path for each byte,
+	operators come from a small transition table and keywords are found
+	with a perfect hash, so a token costs a few table lookups instead of a
+	walk through flex's generic DFA tables.
+*/
+#include "header.c"
+#include "y.tab.h"
+#include <stdio.h>
+#include "toklog.c"
+#include "tokstream.c"
+#include "srcmap.c"
+#include "linetab.c"
+#include "intern.c"
+#include "numlit.c"
+#include "replay.c"
+#include "utf8id.c"
+#include "hscan.c"
+#include "plex.c"
+#include "lexer.c"
+
+/* scans the next token of lx into *lval; the parser's yylex with api.pure */
+int yylex(YYSTYPE *lval, LEXER *lx)
+{
+	REPLAYTOK r;
+	HTOK t;
+	int code, id;
+	if(lx->replaying)
+	{
+		code = nextReplay(lx, &r);
+		lval->tok.v = r.text;
+		lval->tok.id = r.id ? r.id : internToken(&lx->names, code, r.text);
+		lval->tok.loc = lx->tokpos = r.offset;
+		if(code == T_NUM)
+			lexNumber(lx, NULL, r.id, r.offset);
+		return code;
+	}
+	code = hscan(&lx->p, lx->end, &t);
+	if(code == 0)
+		return 0;
+	lval->tok.loc = lx->tokpos = t.start - lx->buf;
+	lx->tokoff = lx->p - lx->buf;
+	if(t.text != NULL)
+	{
+		lval->tok.v = t.text;
+		lval->tok.id = internToken(&lx->names, code, t.text);
+	}
+	else
+	{
+		lval->tok.id = id = intern(&lx->names, t.start, t.len);
+		lval->tok.v = internStr(&lx->names, id);
+		if(code == T_NUM)
+			lexNumber(lx, NULL, id, lx->tokpos);
+	}
+	addTokenToFile(&lx->log, t.kind, lval->tok.v);
+	putTokenRecord(lx, code, lx->tokpos, t.len);
+	return code;
+}
+
+/* maps path, or reads it whole when it cannot be mapped */
+int openSource(LEXER *lx, char *path)
+{
+	size_t len, cap, n;
+	FILE *f;
+	lx->buf = mapSource(&lx->src, path, &len);
+	if(lx->buf == NULL)
+	{
+		f = fopen(path, "r");
+		if(f == NULL)
+			return -1;
+		cap = 1<<16;
+		len = 0;
+		lx->readbuf = (char*)malloc(cap);
+		while((n = fread(lx->readbuf + len, 1, cap - len, f)) > 0)
+		{
+			len += n;
+			if(len == cap)
+				lx->readbuf = (char*)realloc(lx->readbuf, cap *= 2);
+		}
+		fclose(f);
+		lx->buf = lx->readbuf;
+	}
+	lx->p = lx->buf;
+	lx->end = lx->buf + len;
+	lineTableSource(&lx->lines, lx->buf, len);
+	return 0;
+}
+
+void closeSource(LEXER *lx)
+{
+	unmapSource(&lx->src);
+	free(lx->readbuf);
+	lx->readbuf = NULL;
+	lx->buf = lx->p = lx->end = NULL;
+}
@@ -0,0 +1,249 @@
+/*
+	Scanner core shared by hlex.c and the parallel lexer in plex.c.
+	hscan() finds the next token in [*pp, end) using only its arguments and
+	read-only tables, so any number of threads can run it on separate
+	ranges of the same buffer. It accepts the language of sym.l and
+	returns the codes in jtok.h.
+
+	Identifiers follow Java: '_', '$' and non-ASCII letters are allowed.
+	Their end is found with identEnd(), which tests a block of bytes at a
+	time and only decodes UTF-8 once it meets a non-ASCII byte.
+
+	Include after srcmap.c (for skipBlockComment) and utf8id.c.
+*/
+#include "jtok.h"
+
+#define CL_OTHER 0
+#define CL_ALPHA 1
+#define CL_DIGIT 2
+#define CL_OP 3
+#define CL_UTF8 4		/* lead byte of a multi-byte UTF-8 sequence */
+
+static const unsigned char cclass[256] = {
+	['0' ... '9'] = CL_DIGIT,
+	['A' ... 'Z'] = CL_ALPHA,
+	['a' ... 'z'] = CL_ALPHA,
+	['_'] = CL_ALPHA, ['$'] = CL_ALPHA,
+	[0xC2 ... 0xF4] = CL_UTF8,
+	['('] = CL_OP, [')'] = CL_OP, ['{'] = CL_OP, ['}'] = CL_OP,
+	['['] = CL_OP, [']'] = CL_OP, ['.'] = CL_OP, [','] = CL_OP,
+	[';'] = CL_OP, ['+'] = CL_OP, ['-'] = CL_OP, ['*'] = CL_OP,
+	['/'] = CL_OP, ['%'] = CL_OP, ['='] = CL_OP, ['!'] = CL_OP,
+	['<'] = CL_OP, ['>'] = CL_OP, ['&'] = CL_OP, ['|'] = CL_OP,
+	['^'] = CL_OP, ['~'] = CL_OP,
+};
+
+typedef struct optok
+{
+	char *text;
+	char *kind;
+	int code;
+}OPTOK;
+
+/* one state per first character: its own token plus up to three two-char extensions */
+typedef struct opstate
+{
+	OPTOK one;
+	char next[4];
+	OPTOK two[3];
+}OPSTATE;
+
+static const OPSTATE optab[128] = {
+	['('] = {{"(", "Brackets", '('}},
+	[')'] = {{")", "Brackets", ')'}},
+	['{'] = {{"{", "Brackets", '{'}},
+	['}'] = {{"}", "Brackets", '}'}},
+	['['] = {{"[", "Brackets", '['}},
+	[']'] = {{"]", "Brackets", ']'}},
+	['.'] = {{".", "dot", '.'}},
+	[','] = {{",", "comma", ','}},
+	[';'] = {{";", "semi-colon", ';'}},
+	['~'] = {{"~", "Bitwise operator", '~'}},
+	['+'] = {{"+", "Arithmetic operator", JT_ADD}, "+=",
+		{{"++", "Unary operator", JT_INC}, {"+=", "Assignment operator", JT_ADDASSGN}}},
+	['-'] = {{"-", "Arithmetic operator", JT_SUB}, "-=",
+		{{"--", "Unary operator", JT_DEC}, {"-=", "Assignment operator", JT_SUBASSGN}}},
+	['*'] = {{"*", "Arithmetic operator", JT_MUL}, "=",
+		{{"*=", "Assignment operator", JT_MULASSGN}}},
+	['/'] = {{"/", "Arithmetic operator", JT_DIV}, "=",
+		{{"/=", "Assignment operator", JT_DIVASSGN}}},
+	['%'] = {{"%", "Arithmetic operator", '%'}, "=",
+		{{"%=", "Assignment operator", JT_MODASSGN}}},
+	['='] = {{"=", "Assignment operator", JT_ASSGN}, "=",
+		{{"==", "Comparison operator", JT_EQ}}},
+	['!'] = {{"!", "Bitwise operator", '!'}, "=",
+		{{"!=", "Comparison operator", JT_NEQ}}},
+	['&'] = {{"&", "Bitwise operator", JT_AND}, "&=",
+		{{"&&", "Logical operator", JT_LOGAND}, {"&=", "Assignment operator", JT_ANDASSGN}}},
+	['|'] = {{"|", "Bitwise operator", JT_OR}, "|=",
+		{{"||", "Logical operator", JT_LOGOR}, {"|=", "Assignment operator", JT_ORASSGN}}},
+	['^'] = {{"^", "Bitwise operator", JT_XOR}, "=",
+		{{"^=", "Assignment operator", JT_XORASSGN}}},
+	['>'] = {{">", "Comparison operator", JT_GT}, "=>",
+		{{">=", "Assignment operator", JT_GTEQ}, {">>", "Bitwise operator", JT_RS}}},
+	['<'] = {{"<", "Comparison operator", JT_LT}, "=<",
+		{{"<=", "Assignment operator", JT_LTEQ}, {"<<", "Bitwise operator", JT_LS}}},
+};
+
+typedef struct keyword
+{
+	char *text;
+	int len;
+	int code;
+}KEYWORD;
+
+/*
+	Perfect hash over the 15 keywords:
+		(len*9 + first*6 + last) & 15
+	Every keyword lands in its own slot; slot 10 is unused.
+*/
+#define KWHASH(s,n) (((n)*9 + (unsigned char)(s)[0]*6 + (unsigned char)(s)[(n)-1]) & 15)
+
+static const KEYWORD kwtab[16] = {
+	{"main", 4, JT_MAIN},
+	{"for", 3, JT_FOR},
+	{"class", 5, JT_CLASS},
+	{"double", 6, JT_DOUBLE},
+	{"private", 7, JT_PRIVATE},
+	{"int", 3, JT_INT},
+	{"new", 3, JT_NEW},
+	{"else", 4, JT_ELSE},
+	{"char", 4, JT_CHAR},
+	{"public", 6, JT_PUBLIC},
+	{NULL, 0, 0},
+	{"static", 6, JT_STATIC},
+	{"void", 4, JT_VOID},
+	{"args", 4, JT_ARGS},
+	{"if", 2, JT_IF},
+	{"String", 6, JT_STRING},
+};
+
+/* tokens.txt kind of each token code, for callers that only kept the code */
+static char *kindname[JT_LAST+1] = {
+	['('] = "Brackets", [')'] = "Brackets", ['{'] = "Brackets", ['}'] = "Brackets",
+	['['] = "Brackets", [']'] = "Brackets", ['.'] = "dot", [','] = "comma",
+	[';'] = "semi-colon", ['!'] = "Bitwise operator", ['~'] = "Bitwise operator",
+	['%'] = "Arithmetic operator",
+	[JT_CLASS] = "Keyword", [JT_PUBLIC] = "Keyword", [JT_PRIVATE] = "Keyword",
+	[JT_STATIC] = "Keyword", [JT_VOID] = "Keyword", [JT_INT] = "Keyword",
+	[JT_CHAR] = "Keyword", [JT_DOUBLE] = "Keyword", [JT_IF] = "Keyword",
+	[JT_ELSE] = "Keyword", [JT_NEW] = "Keyword", [JT_STRING] = "Keyword",
+	[JT_ARGS] = "Keyword", [JT_FOR] = "Keyword", [JT_MAIN] = "Keyword",
+	[JT_ID] = "Identifier", [JT_NUM] = "NUM",
+	[JT_INC] = "Unary operator", [JT_DEC] = "Unary operator",
+	[JT_LOGOR] = "Logical operator", [JT_LOGAND] = "Logical operator",
+	[JT_EQ] = "Comparison operator", [JT_NEQ] = "Comparison operator",
+	[JT_GT] = "Comparison operator", [JT_LT] = "Comparison operator",
+	[JT_GTEQ] = "Assignment operator", [JT_LTEQ] = "Assignment operator",
+	[JT_ADD] = "Arithmetic operator", [JT_SUB] = "Arithmetic operator",
+	[JT_MUL] = "Arithmetic operator", [JT_DIV] = "Arithmetic operator",
+	[JT_OR] = "Bitwise operator", [JT_AND] = "Bitwise operator", [JT_XOR] = "Bitwise operator",
+	[JT_LS] = "Bitwise operator", [JT_RS] = "Bitwise operator",
+	[JT_ASSGN] = "Assignment operator", [JT_MULASSGN] = "Assignment operator",
+	[JT_DIVASSGN] = "Assignment operator", [JT_MODASSGN] = "Assignment operator",
+	[JT_ADDASSGN] = "Assignment operator", [JT_SUBASSGN] = "Assignment operator",
+	[JT_ANDASSGN] = "Assignment operator", [JT_XORASSGN] = "Assignment operator",
+	[JT_ORASSGN] = "Assignment operator",
+};
+
+typedef struct htok
+{
+	int code;
+	char *start;
+	int len;
+	char *kind;			/* kind written to tokens.txt */
+	char *text;			/* fixed spelling, NULL for identifiers and numbers */
+}HTOK;
+
+/* scans the next token; returns its code, or 0 at end */
+int hscan(char **pp, char *end, HTOK *t)
+{
+	char *p = *pp, *s;
+	const OPSTATE *st;
+	const OPTOK *tk;
+	const KEYWORD *kw;
+	int i, n;
+	for(;;)
+	{
+		if(p >= end)
+		{
+			*pp = p;
+			return t->code = 0;
+		}
+		s = p;
+		switch(cclass[(unsigned char)*p])
+		{
+		case CL_UTF8:
+			if((n = utf8IdentChar(p, end, 1)) == 0)
+			{
+				p++;
+				continue;
+			}
+			p = (char*)identEnd(p + n, end);
+			goto ident;
+		case CL_ALPHA:
+			p = (char*)identEnd(p + 1, end);
+		ident:
+			n = p - s;
+			kw = &kwtab[KWHASH(s, n)];
+			*pp = p;
+			t->start = s;
+			t->len = n;
+			if(kw->len == n && memcmp(kw->text, s, n) == 0)
+			{
+				t->kind = "Keyword";
+				t->text = kw->text;
+				return t->code = kw->code;
+			}
+			t->kind = "Identifier";
+			t->text = NULL;
+			return t->code = JT_ID;
+		case CL_DIGIT:
+			while(p < end && cclass[(unsigned char)*p] == CL_DIGIT)
+				p++;
+			if(p < end && *p == '.')
+				p++;
+			while(p < end && cclass[(unsigned char)*p] == CL_DIGIT)
+				p++;
+			*pp = p;
+			t->start = s;
+			t->len = p - s;
+			t->kind = "NUM";
+			t->text = NULL;
+			return t->code = JT_NUM;
+		case CL_OP:
+			if(*p == '/' && p+1 < end && p[1] == '/')
+			{
+				p = memchr(p, '\n', end - p);
+				if(p == NULL)
+					p = end;
+				continue;
+			}
+			if(*p == '/' && p+1 < end && p[1] == '*')
+			{
+				p = skipBlockComment(p+2, end);
+				continue;
+			}
+			st = &optab[(unsigned char)*p];
+			tk = &st->one;
+			p++;
+			if(p < end)
+				for(i=0;st->next[i];i++)
+					if(st->next[i] == *p)
+					{
+						tk = &st->two[i];
+						p++;
+						break;
+					}
+			*pp = p;
+			t->start = s;
+			t->len = p - s;
+			t->kind = tk->kind;
+			t->text = tk->text;
+			return t->code = tk->code;
+		default:
+			p++;
+			continue;
+		}
+	}
+}
@@ -0,0 +1,146 @@
+/*
+	String interning pool for identifiers and literals.
+	Every distinct spelling is stored once in an arena and gets a small
+	integer id; the returned char* is the same for equal strings, so names
+	can be compared by id or by pointer instead of strcmp.
+	Id 0 is reserved for "no string". Ids belong to one pool; each
+	compilation has its own in its LEXER (lexer.h).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lexer.h"
+
+#define INTERN_CHUNK (1<<16)
+
+typedef struct internchunk
+{
+	struct internchunk *next;
+	size_t used;
+	size_t size;
+	char data[];
+}INTERNCHUNK;
+
+static unsigned internHash(const char *s, int len)
+{
+	unsigned h = 2166136261u;
+	int i;
+	for(i=0;i<len;i++)
+	{
+		h ^= (unsigned char)s[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static char* internAlloc(INTERNPOOL *ip, size_t n)
+{
+	INTERNCHUNK *c = ip->chunk;
+	char *p;
+	if(c == NULL || c->used + n > c->size)
+	{
+		size_t size = n > INTERN_CHUNK ? n : INTERN_CHUNK;
+		c = (INTERNCHUNK*)malloc(sizeof(INTERNCHUNK) + size);
+		c->next = ip->chunk;
+		c->used = 0;
+		c->size = size;
+		ip->chunk = c;
+	}
+	p = c->data + c->used;
+	c->used += n;
+	return p;
+}
+
+static void internGrow(INTERNPOOL *ip)
+{
+	unsigned i, j, nslot = ip->nslot ? ip->nslot*2 : 1024;
+	unsigned *slot = (unsigned*)calloc(nslot, sizeof(unsigned));
+	for(i=0;i<ip->nslot;i++)
+		if(ip->slot[i])
+		{
+			j = ip->hash[ip->slot[i]] & (nslot-1);
+			while(slot[j])
+				j = (j+1) & (nslot-1);
+			slot[j] = ip->slot[i];
+		}
+	free(ip->slot);
+	ip->slot = slot;
+	ip->nslot = nslot;
+}
+
+/* returns the id of s[0..len), adding it to the pool if it is new */
+int intern(INTERNPOOL *ip, const char *s, int len)
+{
+	unsigned h = internHash(s, len);
+	unsigned j, id;
+	if((unsigned)ip->n*2 >= ip->nslot)
+		internGrow(ip);
+	j = h & (ip->nslot-1);
+	while((id = ip->slot[j]) != 0)
+	{
+		if(ip->hash[id] == h && ip->len[id] == len && memcmp(ip->str[id], s, len) == 0)
+			return id;
+		j = (j+1) & (ip->nslot-1);
+	}
+	if(ip->n >= ip->cap)
+	{
+		ip->cap = ip->cap ? ip->cap*2 : 1024;
+		ip->hash = (unsigned*)realloc(ip->hash, ip->cap*sizeof(unsigned));
+		ip->str = (char**)realloc(ip->str, ip->cap*sizeof(char*));
+		ip->len = (int*)realloc(ip->len, ip->cap*sizeof(int));
+		ip->str[0] = NULL;
+		ip->len[0] = 0;
+	}
+	id = ip->n++;
+	ip->hash[id] = h;
+	ip->len[id] = len;
+	ip->str[id] = internAlloc(ip, len+1);
+	memcpy(ip->str[id], s, len);
+	ip->str[id][len] = '\0';
+	ip->slot[j] = id;
+	return id;
+}
+
+char* internStr(INTERNPOOL *ip, int id)
+{
+	return id > 0 && id < ip->n ? ip->str[id] : NULL;
+}
+
+/* id of the fixed spelling of token code, interned the first time the code is seen */
+int internToken(INTERNPOOL *ip, int code, const char *s)
+{
+	if(code < 0 || code >= INTERN_TOKENS)
+		return intern(ip, s, strlen(s));
+	if(ip->tokid[code] == 0)
+		ip->tokid[code] = intern(ip, s, strlen(s));
+	return ip->tokid[code];
+}
+
+/* shorthand for callers that only want the canonical pointer */
+char* internCStr(INTERNPOOL *ip, const char *s)
+{
+	return internStr(ip, intern(ip, s, strlen(s)));
+}
+
+int internCount(INTERNPOOL *ip)
+{
+	return ip->n - 1;
+}
+
+/* frees every string and leaves the pool empty */
+void freeInternPool(INTERNPOOL *ip)
+{
+	INTERNCHUNK *c, *next;
+	for(c=ip->chunk;c!=NULL;c=next)
+	{
+		next = c->next;
+		free(c);
+	}
+	free(ip->slot);
+	free(ip->hash);
+	free(ip->str);
+	free(ip->len);
+	memset(ip, 0, sizeof(INTERNPOOL));
+	ip->n = 1;
+}
@@ -0,0 +1,295 @@
+/*
+	Synthetic input generator for the lexer benchmark.
+	Writes a program in the Java subset every phase accepts: one class with
+	main(), declarations, assignments with long expressions, nested if/else
+	and for blocks, and plenty of line and block comments. With -t it
+	writes three-address code in the icg.txt format for optimicons.l.
+
+	usage: javagen [-b size[K|M|G]] [-n statements] [-d depth] [-e terms] [-c percent] [-u percent] [-s seed] [-t] > out
+		-b	stop after about this many bytes (default 1M)
+		-n	stop after this many statements in main() instead (with -t, about this many instructions)
+		-d	deepest nesting of if/for blocks (default 4)
+		-e	most operands in one expression (default 12)
+		-c	chance of a comment before a statement, in percent (default 30)
+		-u	share of names spelled with '$', '_' or non-ASCII letters, in percent (default 0)
+		-s	random seed, so runs can be repeated (default 1)
+		-t	write TAC instead of Java
+
+	Java names are unique and declared before use, divisions are by
+	non-zero constants, and no name is longer than the symbol table's 30
+	chars.
+	Statement lists are left-recursive in every grammar, so any number of
+	statements parses within bison's default stack. The stress test is
+		javagen -n 1000000 -d 0 > million.java
+	and Lexer/stress.sh runs every parser on such a file.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+static unsigned long long seed = 1;
+static long long written = 0, limit = 1<<20;
+static int maxdepth = 4, maxterms = 12, commentpct = 30, unicodepct = 0;
+static int nvars = 0, ntemps = 0, nlabels = 0;
+static long nstatements = 0;
+
+static unsigned rnd(unsigned n)
+{
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (unsigned)(seed >> 33) % n;
+}
+
+static void out(const char *fmt, ...)
+{
+	va_list ap;
+	va_start(ap, fmt);
+	written += vprintf(fmt, ap);
+	va_end(ap);
+}
+
+static void indent(int depth)
+{
+	int i;
+	for(i=0;i<depth+2;i++)
+		out("\t");
+}
+
+/* spellings Java allows beyond [A-Za-z][A-Za-z0-9]*, all under 30 bytes with the number */
+static const char *uprefix[] = {"$v", "_v", "ñ", "π", "переменная", "変数", "ω_"};
+
+/* name of variable i; the choice depends only on i so every use agrees */
+static void name(unsigned i)
+{
+	if((i * 2654435761u >> 16) % 100 < (unsigned)unicodepct)
+		out("%s%u", uprefix[i % (sizeof(uprefix)/sizeof(uprefix[0]))], i);
+	else
+		out("v%u", i);
+}
+
+static void var(void)
+{
+	if(nvars == 0)
+		out("%u", rnd(1000));
+	else
+		name(rnd(nvars));
+}
+
+static void expr(int terms)
+{
+	static const char *op[] = {"+", "-", "*", "+", "-"};
+	int i;
+	if(rnd(4) == 0 && terms > 2)
+	{
+		out("(");
+		expr(terms / 2);
+		out(") %s ", op[rnd(5)]);
+		expr(terms - terms / 2);
+		return;
+	}
+	var();
+	for(i=1;i<terms;i++)
+	{
+		if(rnd(8) == 0)
+		{
+			out(" / %u", rnd(9) + 1);
+			continue;
+		}
+		out(" %s ", op[rnd(5)]);
+		if(rnd(3) == 0)
+			out("%u", rnd(100000));
+		else
+			var();
+	}
+}
+
+static void cond(void)
+{
+	static const char *rel[] = {"<", ">", "<=", ">=", "==", "!="};
+	var();
+	out(" %s ", rel[rnd(6)]);
+	var();
+	if(rnd(3) == 0)
+	{
+		out(rnd(2) ? " && " : " || ");
+		var();
+		out(" %s ", rel[rnd(6)]);
+		out("%u", rnd(100));
+	}
+}
+
+static void comment(int depth)
+{
+	int i, n;
+	indent(depth);
+	if(rnd(2))
+	{
+		out("// v%d is updated below, keep the order of these statements\n", nvars);
+		return;
+	}
+	n = rnd(6) + 1;
+	out("/*\n");
+	for(i=0;i<n;i++)
+	{
+		indent(depth);
+		out(" * generated block comment line %d of %d: the lexer skips all of this text\n", i+1, n);
+	}
+	indent(depth);
+	out(" */\n");
+}
+
+static void block(int depth);
+
+static void statement(int depth)
+{
+	unsigned k = rnd(10);
+	if(rnd(100) < (unsigned)commentpct)
+		comment(depth);
+	indent(depth);
+	if(k < 4 || nvars == 0)
+	{
+		out("int ");
+		name(nvars);
+		out(" = ");
+		expr(rnd(maxterms) + 1);
+		out(";\n");
+		nvars++;
+	}
+	else if(k < 7 || depth >= maxdepth)
+	{
+		var();
+		out(" = ");
+		expr(rnd(maxterms) + 1);
+		out(";\n");
+	}
+	else if(k < 9)
+	{
+		out("if(");
+		cond();
+		out(")\n");
+		block(depth);
+		if(rnd(2))
+		{
+			indent(depth);
+			out("else\n");
+			block(depth);
+		}
+	}
+	else
+	{
+		/* if.y only takes an assignment as the loop initialiser */
+		out("int ");
+		name(nvars);
+		out(" = 0;\n");
+		indent(depth);
+		out("for(");
+		name(nvars);
+		out(" = 0; ");
+		name(nvars);
+		out(" < %u; ", rnd(100));
+		name(nvars);
+		out("++)\n");
+		nvars++;
+		block(depth);
+	}
+}
+
+static void block(int depth)
+{
+	int i, n = rnd(4) + 1;
+	indent(depth);
+	out("{\n");
+	for(i=0;i<n;i++)
+		statement(depth + 1);
+	indent(depth);
+	out("}\n");
+}
+
+static void java(void)
+{
+	long i;
+	out("public class Generated\n{\n");
+	out("\tpublic static void main(String []args)\n\t{\n");
+	if(nstatements > 0)
+		for(i=0;i<nstatements;i++)
+			statement(0);
+	else
+		while(written < limit)
+			statement(0);
+	out("\t}\n}\n");
+}
+
+/* runs of temporaries, copies and jumps in the icg.txt format */
+static void tac(void)
+{
+	static const char *op[] = {"+", "-", "*", "/", "<", ">", "<=", ">=", "==", "!="};
+	int i, n, l;
+	long count = 1;
+	out("a = %u\n", rnd(100));
+	while(nstatements > 0 ? count < nstatements : written < limit)
+	{
+		n = rnd(8) + 1;
+		count += 2*n + 3;
+		for(i=0;i<n;i++)
+		{
+			/* a small pool of temporaries, so names recur and their values are looked up */
+			ntemps = ntemps % 50 + 1;
+			if(rnd(2))
+				out("T%d = %u %s %s\n", ntemps, rnd(1000), op[rnd(10)], rnd(2) ? "a" : "b");
+			else
+				out("T%d = a %s %u\n", ntemps, op[rnd(10)], rnd(1000) + 1);
+			out("%c = T%d\n", "abcmk"[rnd(5)], ntemps);
+		}
+		l = ++nlabels;
+		out("L%d:\n", l);
+		out("if T%d go to L%d\n", ntemps, l);
+		out("go to L%d\n", l);
+	}
+}
+
+static long long size(const char *s)
+{
+	char *end;
+	long long n = strtoll(s, &end, 10);
+	if(*end == 'K' || *end == 'k')
+		n <<= 10;
+	else if(*end == 'M' || *end == 'm')
+		n <<= 20;
+	else if(*end == 'G' || *end == 'g')
+		n <<= 30;
+	return n;
+}
+
+int main(int argc, char *argv[])
+{
+	int i, tacmode = 0;
+	for(i=1;i<argc;i++)
+	{
+		if(strcmp(argv[i], "-t") == 0)
+			tacmode = 1;
+		else if(i+1 < argc && strcmp(argv[i], "-b") == 0)
+			limit = size(argv[++i]);
+		else if(i+1 < argc && strcmp(argv[i], "-n") == 0)
+			nstatements = atol(argv[++i]);
+		else if(i+1 < argc && strcmp(argv[i], "-d") == 0)
+			maxdepth = atoi(argv[++i]);
+		else if(i+1 < argc && strcmp(argv[i], "-e") == 0)
+			maxterms = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+		else if(i+1 < argc && strcmp(argv[i], "-c") == 0)
+			commentpct = atoi(argv[++i]);
+		else if(i+1 < argc && strcmp(argv[i], "-u") == 0)
+			unicodepct = atoi(argv[++i]);
+		else if(i+1 < argc && strcmp(argv[i], "-s") == 0)
+			seed = strtoull(argv[++i], NULL, 10);
+		else
+		{
+			fprintf(stderr, "usage: %s [-b size[K|M|G]] [-n statements] [-d depth] [-e terms] [-c percent] [-u percent] [-s seed] [-t]\n", argv[0]);
+			return 1;
+		}
+	}
+	if(tacmode)
+		tac();
+	else
+		java();
+	return 0;
+}
@@ -0,0 +1,59 @@
+/*
+	Token codes used in the binary token stream.
+	They are the codes bison assigns to the %token list shared by sym.y and
+	if.y (see their y.tab.h), given a JT_ prefix so phases with their own
+	numbering, like Symbol_Table_Gen, can include both and translate.
+	Keep this in step with that %token list.
+*/
+#ifndef JTOK_H
+#define JTOK_H
+#define JT_CLASS 258
+#define JT_PUBLIC 259
+#define JT_PRIVATE 260
+#define JT_STATIC 261
+#define JT_FINAL 262
+#define JT_VOID 263
+#define JT_INT 264
+#define JT_CHAR 265
+#define JT_DOUBLE 266
+#define JT_IF 267
+#define JT_ELSE 268
+#define JT_NEW 269
+#define JT_INC 270
+#define JT_DEC 271
+#define JT_LOGOR 272
+#define JT_LOGAND 273
+#define JT_OR 274
+#define JT_AND 275
+#define JT_EQ 276
+#define JT_NEQ 277
+#define JT_GTEQ 278
+#define JT_LTEQ 279
+#define JT_ADD 280
+#define JT_SUB 281
+#define JT_MUL 282
+#define JT_DIV 283
+#define JT_GT 284
+#define JT_LT 285
+#define JT_XOR 286
+#define JT_MOD 287
+#define JT_LS 288
+#define JT_RS 289
+#define JT_NUM 290
+#define JT_ID 291
+#define JT_STRING 292
+#define JT_ARGS 293
+#define JT_PRINT 294
+#define JT_FOR 295
+#define JT_MAIN 296
+#define JT_ASSGN 297
+#define JT_MULASSGN 298
+#define JT_DIVASSGN 299
+#define JT_MODASSGN 300
+#define JT_ADDASSGN 301
+#define JT_SUBASSGN 302
+#define JT_ANDASSGN 303
+#define JT_XORASSGN 304
+#define JT_ORASSGN 305
+#define JT_LAST JT_ORASSGN
+#endif
@@ -0,0 +1,124 @@
+/*
+	Lexer throughput benchmark.
+	Lexes one file to the end and reports tokens/s, bytes/s and the heap
+	allocations the scanner made while doing it. It links against a phase's
+	scanner and parser; the phase's own main() is renamed with
+	-Dmain=phase_main. Build it from the phase folder after lex/yacc:
+
+	AST or ICG, sym.l:
+		gcc -O2 -I. -I../Lexer -pthread -Dmain=phase_main ../Lexer/lexbench.c lex.yy.c y.tab.c -o bench
+	AST or ICG, hlex.c:
+		gcc -O2 -I. -I../Lexer -pthread -Dmain=phase_main ../Lexer/lexbench.c ../Lexer/hlex.c y.tab.c -o bench
+	Symbol_Table_Gen, lexer.l (its lex.yy.c already includes y.tab.c):
+		gcc -O2 -Dmain=phase_main ../Lexer/lexbench.c lex.yy.c -o bench
+	Optimized_Code_Gen, optimicons.l:
+		gcc -O2 -Dmain=phase_main ../Lexer/lexbench.c lex.yy.c y.tab.c -o bench
+	Optimized_Code_Gen, tacread.c:
+		gcc -O2 -I. -Dmain=phase_main ../Lexer/lexbench.c tacread.c y.tab.c -o bench
+
+	usage: ./bench file [name]
+	Make inputs with javagen (javagen -t for the optimizer).
+	Allocations are counted by wrapping glibc's malloc, calloc and realloc.
+*/
+#undef main
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "lexer.h"
+
+/*
+	The AST, ICG and optimizer scanners are pure: yylex(lval, lx) fills
+	lval and keeps all its state in lx. lexer.l is not; Symbol_Table_Gen
+	has one global LEXER called lex, which is how the two are told apart.
+*/
+int yylex();
+int openSource() __attribute__((weak));
+void closeSource(LEXER *lx) __attribute__((weak));
+void initLexer(LEXER *lx);
+extern LEXER lex __attribute__((weak));
+/* a scanner without openSource() reads yyin */
+extern FILE *yyin __attribute__((weak));
+
+extern void *__libc_malloc(size_t);
+extern void *__libc_calloc(size_t, size_t);
+extern void *__libc_realloc(void*, size_t);
+
+static long nalloc = 0;
+static size_t nbytes = 0;
+
+void* malloc(size_t n)
+{
+	nalloc++;
+	nbytes += n;
+	return __libc_malloc(n);
+}
+
+void* calloc(size_t n, size_t size)
+{
+	nalloc++;
+	nbytes += n * size;
+	return __libc_calloc(n, size);
+}
+
+void* realloc(void *p, size_t n)
+{
+	nalloc++;
+	nbytes += n;
+	return __libc_realloc(p, n);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+	struct stat st;
+	LEXER lx;
+	union { void *p; long long i; double d; char c[256]; } lval;	/* room for any phase's YYSTYPE */
+	int pure = &lex == NULL;
+	long ntok = 0, a0;
+	size_t b0;
+	double t0, t;
+	if(argc < 2 || stat(argv[1], &st) != 0)
+	{
+		printf("usage: %s file [name]\n", argv[0]);
+		return 1;
+	}
+	initLexer(&lx);
+	lx.log.mode = TOKLOG_OFF;
+	a0 = nalloc;
+	b0 = nbytes;
+	t0 = now();
+	if(openSource != NULL)
+	{
+		if((pure ? openSource(&lx, argv[1]) : openSource(argv[1])) != 0)
+		{
+			printf("cannot open %s\n", argv[1]);
+			return 1;
+		}
+	}
+	else if(&yyin == NULL || (yyin = fopen(argv[1], "r")) == NULL)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	if(pure)
+		while(yylex(&lval, &lx) != 0)
+			ntok++;
+	else
+		while(yylex() != 0)
+			ntok++;
+	if(closeSource != NULL)
+		closeSource(&lx);
+	t = now() - t0;
+	printf("%-10s %10ld bytes %9ld tokens %8.3f s %12.0f tokens/s %8.1f MB/s %9ld allocs %10zu bytes allocated %6.2f allocs/ktoken\n",
+		argc > 2 ? argv[2] : "lexer", (long)st.st_size, ntok, t, ntok / t, st.st_size / t / 1e6,
+		nalloc - a0, nbytes - b0, ntok ? (nalloc - a0) * 1000.0 / ntok : 0.0);
+	return 0;
+}
@@ -0,0 +1,27 @@
+/*
+	Setting up and tearing down a LEXER (lexer.h).
+	A phase calls initLexer() once per compilation before opening its
+	source, and freeLexer() after the last use of an interned string or a
+	line number. The token log, the --tokbin stream and a replay are
+	closed by their own calls first, since those flush files.
+
+	Include after intern.c, srcmap.c, linetab.c and numlit.c.
+*/
+
+void initLexer(LEXER *lx)
+{
+	memset(lx, 0, sizeof(LEXER));
+	lx->names.n = 1;
+	lx->log.mode = TOKLOG_FULL;
+}
+
+void freeLexer(LEXER *lx)
+{
+	freeInternPool(&lx->names);
+	freeLineTable(&lx->lines);
+	freeNumCache(&lx->nums);
+	unmapSource(&lx->src);
+	free(lx->readbuf);
+	free(lx->ring);
+	initLexer(lx);
+}
@@ -0,0 +1,128 @@
+/*
+	State of one compilation's lexer.
+	The scanners and the modules in this folder used to keep their state
+	in globals. It now lives in a LEXER that the phase owns and passes to
+	yylex() and to every module call, so two compilations share nothing
+	and can run on different threads at once. In the AST, ICG and
+	optimizer builds what is left at file scope is const: hscan.c's
+	tables, utf8id.c's ranges and replay.c's spellings. Symbol_Table_Gen
+	reads one file per run and still keeps its LEXER, its stream line
+	count and the current scope in globals.
+
+	The parts are declared here so a phase can hold a LEXER by value; each
+	module still documents its own part. Set one up with initLexer() and
+	release it with freeLexer() (lexer.c).
+*/
+#ifndef LEXER_H
+#define LEXER_H
+#include <stdio.h>
+#include <stdint.h>
+#include "numlit.h"
+
+/* intern.c */
+#define INTERN_TOKENS 512
+
+typedef struct internpool
+{
+	struct internchunk *chunk;
+	unsigned *slot;		/* hash table of ids, 0 = empty */
+	unsigned nslot;
+	unsigned *hash;		/* hash of each id */
+	char **str;			/* text of each id */
+	int *len;
+	int n;
+	int cap;
+	int tokid[INTERN_TOKENS];	/* id of each token code's fixed spelling, 0 until seen */
+}INTERNPOOL;
+
+/* srcmap.c */
+typedef struct srcmap
+{
+	char *base;
+	size_t len;
+	size_t maplen;
+}SRCMAP;
+
+/* linetab.c */
+typedef struct linetab
+{
+	const char *base;
+	size_t len;
+	char *path;
+	unsigned (*hook)(unsigned off);
+	unsigned *start;	/* offset of the first byte of each line */
+	unsigned n;
+	unsigned cap;
+	int built;
+}LINETAB;
+
+/* toklog.c */
+#define TOKLOG_OFF 0
+#define TOKLOG_SUMMARY 1
+#define TOKLOG_FULL 2
+#define TOKLOG_MAXKINDS 32
+
+typedef struct toklog
+{
+	FILE *fp;
+	int mode;
+	char *buf;
+	int nkinds;
+	char *kind[TOKLOG_MAXKINDS];
+	long count[TOKLOG_MAXKINDS];
+}TOKLOG;
+
+/* tokstream.c */
+typedef struct tokrec
+{
+	int32_t kind;
+	uint32_t offset;
+	uint32_t length;
+}TOKREC;
+
+typedef struct tokmap
+{
+	void *base;
+	size_t size;
+	TOKREC *rec;
+	size_t n;
+}TOKMAP;
+
+/* replay.c */
+typedef struct replay
+{
+	TOKMAP map;
+	size_t next;
+	TOKREC *owned;		/* in-memory stream (plex.c) to free on close */
+}REPLAY;
+
+/* numlit.c */
+typedef struct numcache
+{
+	NUMVAL *val;
+	unsigned char *done;
+	int cap;
+}NUMCACHE;
+
+typedef struct lexer
+{
+	INTERNPOOL names;
+	SRCMAP src;
+	LINETAB lines;
+	TOKLOG log;
+	struct tokwriter *tokw;	/* --tokbin stream, NULL when none is written */
+	REPLAY replay;
+	int replaying;
+	NUMCACHE nums;
+	struct textring *ring;	/* textring.c, allocated on first use */
+	/* where a scanner is in its input */
+	char *buf;
+	char *p;
+	char *end;
+	char *readbuf;			/* malloc'd copy when the input could not be mapped */
+	unsigned tokoff;
+	unsigned tokpos;		/* byte offset of the last token */
+	int tokid;				/* interned id of the last name or number, for sym.l */
+	void *scanner;			/* flex's yyscan_t, for the generated scanners */
+}LEXER;
+#endif
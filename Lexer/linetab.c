@@ -0,0 +1,108 @@
+/*
+	Lazy line table.
+	Tokens and AST nodes carry only a 32-bit byte offset; no scanner counts
+	newlines. When a diagnostic or a debug listing needs a line, the first
+	offsetLine() call collects every line start of the source with memchr
+	and later calls binary search that table.
+
+	The source is either text that stays in memory (lineTableSource(), for
+	mapped files) or a file that is read only when the table is built
+	(lineTableFile()). A scanner whose input is gone once consumed, such
+	as one reading a pipe, installs lineTableHook() instead and answers
+	for its current position.
+
+	Include after srcmap.c.
+*/
+#include "lexer.h"
+
+void lineTableSource(LINETAB *lt, const char *base, size_t len)
+{
+	lt->base = base;
+	lt->len = len;
+	lt->built = 0;
+}
+
+void lineTableFile(LINETAB *lt, const char *path)
+{
+	free(lt->path);
+	lt->path = strdup(path);
+	lt->base = NULL;
+	lt->built = 0;
+}
+
+void lineTableHook(LINETAB *lt, unsigned (*hook)(unsigned off))
+{
+	lt->hook = hook;
+}
+
+static void lineStart(LINETAB *lt, unsigned off)
+{
+	if(lt->n == lt->cap)
+	{
+		lt->cap = lt->cap ? lt->cap*2 : 1024;
+		lt->start = (unsigned*)realloc(lt->start, lt->cap * sizeof(unsigned));
+	}
+	lt->start[lt->n++] = off;
+}
+
+/* builds the table now; call it before the source is unmapped if lookups come later */
+void buildLineTable(LINETAB *lt)
+{
+	const char *p, *q, *end;
+	char buf[1<<16];
+	size_t n, at = 0;
+	FILE *f;
+	lt->n = 0;
+	lineStart(lt, 0);
+	if(lt->base != NULL)
+	{
+		end = lt->base + lt->len;
+		for(p=lt->base;(q = (const char*)memchr(p, '\n', end - p)) != NULL;p=q+1)
+			lineStart(lt, q + 1 - lt->base);
+	}
+	else if(lt->path != NULL && (f = fopen(lt->path, "r")) != NULL)
+	{
+		while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+		{
+			for(p=buf;(q = (const char*)memchr(p, '\n', buf + n - p)) != NULL;p=q+1)
+				lineStart(lt, at + (q + 1 - buf));
+			at += n;
+		}
+		fclose(f);
+	}
+	lt->built = 1;
+}
+
+/* 1-based line of byte offset off, with its 1-based column in *col if col is not NULL */
+unsigned offsetLine(LINETAB *lt, unsigned off, unsigned *col)
+{
+	unsigned lo = 0, hi, mid;
+	if(lt->hook != NULL)
+	{
+		if(col != NULL)
+			*col = 0;
+		return lt->hook(off);
+	}
+	if(!lt->built)
+		buildLineTable(lt);
+	hi = lt->n;
+	/* last line starting at or before off */
+	while(hi - lo > 1)
+	{
+		mid = (lo + hi) / 2;
+		if(lt->start[mid] <= off)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	if(col != NULL)
+		*col = off - lt->start[lo] + 1;
+	return lo + 1;
+}
+
+void freeLineTable(LINETAB *lt)
+{
+	free(lt->path);
+	free(lt->start);
+	memset(lt, 0, sizeof(LINETAB));
+}
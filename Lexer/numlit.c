@@ -0,0 +1,154 @@
+/*
+	Numeric literals.
+	decodeNumber() turns the text matched by [0-9]+[.]?[0-9]* into a 64-bit
+	integer or a double. Integers are accumulated digit by digit with an
+	overflow check; short reals are scaled exactly by a power of ten and
+	only long ones go through strtod(). numValue() caches the result for
+	each interned spelling, so a literal that appears many times is decoded
+	once per compilation.
+
+	Include after intern.c and linetab.c.
+*/
+#include <limits.h>
+#include <math.h>
+#include "numlit.h"
+#include "lexer.h"
+
+static const double pow10tab[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* decodes s[0..len); returns -1 if the value overflowed, else 0 */
+int decodeNumber(const char *s, size_t len, NUMVAL *v)
+{
+	unsigned long long m = 0;
+	size_t k;
+	int dot = 0, digits = 0, frac = 0, d;
+	char buf[64], *tmp;
+	v->kind = NUM_INT;
+	v->overflow = 0;
+	for(k=0;k<len;k++)
+	{
+		if(s[k] == '.')
+		{
+			dot = 1;
+			v->kind = NUM_REAL;
+			continue;
+		}
+		d = s[k] - '0';
+		if(m == 0 && d == 0 && !dot)
+			continue;
+		if(digits < 19)
+			m = m*10 + d;
+		digits++;
+		if(dot && digits <= 19)
+			frac++;
+	}
+	if(v->kind == NUM_INT)
+	{
+		if(digits > 19 || m > (unsigned long long)LLONG_MAX)
+		{
+			v->overflow = 1;
+			v->i = LLONG_MAX;
+		}
+		else
+			v->i = (long long)m;
+		v->d = (double)v->i;
+		return v->overflow ? -1 : 0;
+	}
+	/* m and 10^frac are both exact doubles here, so one division rounds correctly */
+	if(digits <= 15 && frac <= 22)
+		v->d = (double)m / pow10tab[frac];
+	else
+	{
+		tmp = len < sizeof(buf) ? buf : (char*)malloc(len+1);
+		memcpy(tmp, s, len);
+		tmp[len] = '\0';
+		v->d = strtod(tmp, NULL);
+		if(tmp != buf)
+			free(tmp);
+	}
+	v->overflow = isinf(v->d);
+	v->i = v->d < 9.2e18 ? (long long)v->d : LLONG_MAX;
+	return v->overflow ? -1 : 0;
+}
+
+/* the decoded value of literal id in lx's pool */
+NUMVAL* numValue(LEXER *lx, int id)
+{
+	NUMCACHE *c = &lx->nums;
+	int cap;
+	if(id >= c->cap)
+	{
+		cap = c->cap ? c->cap : 256;
+		while(cap <= id)
+			cap *= 2;
+		c->val = (NUMVAL*)realloc(c->val, cap * sizeof(NUMVAL));
+		c->done = (unsigned char*)realloc(c->done, cap);
+		memset(c->done + c->cap, 0, cap - c->cap);
+		c->cap = cap;
+	}
+	if(!c->done[id])
+	{
+		decodeNumber(lx->names.str[id], lx->names.len[id], &c->val[id]);
+		c->done[id] = 1;
+	}
+	return &c->val[id];
+}
+
+/*
+	decodes literal id at byte offset off, warning once if it overflowed,
+	and copies its value into v unless v is NULL. The shared lexers pass
+	NULL: their parsers look the value up later with numValue(tok.id).
+*/
+void lexNumber(LEXER *lx, NUMVAL *v, int id, unsigned off)
+{
+	int first = id >= lx->nums.cap || !lx->nums.done[id];
+	NUMVAL *n = numValue(lx, id);
+	if(v != NULL)
+		*v = *n;
+	if(n->overflow && first)
+		fprintf(stderr, "line %u: numeric literal %s is out of range\n", offsetLine(&lx->lines, off, NULL), internStr(&lx->names, id));
+}
+
+void freeNumCache(NUMCACHE *c)
+{
+	free(c->val);
+	free(c->done);
+	memset(c, 0, sizeof(NUMCACHE));
+}
+
+/* formats v into buf so the lexers read back the same value; reals always keep a '.' */
+int formatNumber(char *buf, size_t size, NUMVAL *v)
+{
+	char *p;
+	int prec;
+	if(v->kind == NUM_INT)
+		return snprintf(buf, size, "%lld", v->i);
+	for(prec=15;prec<17;prec++)
+	{
+		snprintf(buf, size, "%.*g", prec, v->d);
+		if(strtod(buf, NULL) == v->d)
+			break;
+	}
+	if(prec == 17)
+		snprintf(buf, size, "%.17g", v->d);
+	/* the lexers have no exponent syntax */
+	if(strchr(buf, 'e') != NULL)
+	{
+		snprintf(buf, size, "%.20f", v->d);
+		for(p=buf+strlen(buf)-1;*p == '0' && p[-1] != '.';p--)
+			*p = '\0';
+	}
+	if(strchr(buf, '.') == NULL)
+		strcat(buf, ".0");
+	return strlen(buf);
+}
+
+void printNumber(FILE *fp, NUMVAL *v)
+{
+	char buf[NUM_MAXTEXT];
+	formatNumber(buf, sizeof(buf), v);
+	fputs(buf, fp);
+}
@@ -0,0 +1,19 @@
+/*
+	Decoded numeric literal.
+	The lexers convert a number's text once and every later phase works on
+	this value instead of calling atoi()/snprintf() again.
+*/
+#ifndef NUMLIT_H
+#define NUMLIT_H
+#define NUM_INT 0
+#define NUM_REAL 1
+#define NUM_MAXTEXT 400	/* formatNumber(): %.20f of the largest double */
+
+typedef struct numval
+{
+	int kind;		/* NUM_INT or NUM_REAL */
+	int overflow;	/* the literal does not fit in an int64 / double */
+	long long i;	/* value for NUM_INT, truncated value for NUM_REAL */
+	double d;		/* value for NUM_REAL, converted value for NUM_INT */
+}NUMVAL;
+#endif
@@ -0,0 +1,118 @@
+/*
+	Parser benchmark for the AST and ICG phases.
+	Parses one file and reports the size of a parser value, the tokens
+	shifted, the bytes of token values pushed onto bison's value stack,
+	and the time taken. Every reduction pushes one more value of the same
+	size, so the smaller the value, the less the parser copies.
+	Like lexbench.c, the phase's own main() is renamed. yylex is wrapped
+	so tokens can be counted. The parse gets a COMPILATION of its own set
+	up by the phase's initCompilation(), with output going to /dev/null.
+	Build it from the phase folder after yacc:
+		gcc -O2 -I. -I../Lexer -pthread -Dmain=phase_main -Wl,--wrap=yylex ../Lexer/parsebench.c ../Lexer/hlex.c y.tab.c -o pbench
+
+	Built with -DYYDEBUG=1 as well, the parser's trace is turned on and
+	sent to a stream that only counts its "Reducing" lines, and the number
+	of reductions is printed too. The trace costs far more than the parse,
+	so the time of such a build means nothing; build twice to get both.
+
+	In the AST phase, --rd times the recursive-descent parser instead of
+	the bison one; add rdparse.c to the build line. It shifts nothing, but
+	its ring copies each token value once, so the value bytes still
+	compare.
+
+	Trees from before the parsers were pure need the parsebench.c of
+	their own time.
+
+	usage: ./pbench [--rd] file [name]
+	Make inputs with javagen.
+*/
+#undef main
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "header.c"
+#include "y.tab.h"
+
+int __real_yylex(YYSTYPE *lval, LEXER *lx);
+int openSource(LEXER *lx, char *path);
+void closeSource(LEXER *lx);
+void initCompilation(COMPILATION *cc);
+void freeCompilation(COMPILATION *cc);
+int rdParse(COMPILATION *cc) __attribute__((weak));
+
+extern int yydebug __attribute__((weak));
+
+static long ntok = 0;
+static long nred = 0;
+
+int __wrap_yylex(YYSTYPE *lval, LEXER *lx)
+{
+	int t = __real_yylex(lval, lx);
+	if(t != 0)
+		ntok++;
+	return t;
+}
+
+static ssize_t countReductions(void *cookie, const char *buf, size_t n)
+{
+	const char *p = buf, *end = buf + n;
+	(void)cookie;
+	while((p = memmem(p, end - p, "Reducing stack", 14)) != NULL)
+	{
+		nred++;
+		p += 14;
+	}
+	return n;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+	struct stat st;
+	COMPILATION cc;
+	double t0, t;
+	char *prog = argv[0];
+	int ok, rd = argc > 1 && strcmp(argv[1], "--rd") == 0;
+	argv += rd;
+	argc -= rd;
+	if(argc < 2 || stat(argv[1], &st) != 0 || (rd && rdParse == NULL))
+	{
+		printf("usage: %s [--rd] file [name]\n", prog);
+		return 1;
+	}
+	initCompilation(&cc);
+	cc.lex.log.mode = TOKLOG_OFF;
+	cc.out = fopen("/dev/null", "w");
+	if(&yydebug != NULL && !rd)
+	{
+		stderr = fopencookie(NULL, "w", (cookie_io_functions_t){NULL, countReductions, NULL, NULL});
+		setvbuf(stderr, NULL, _IOLBF, 0);
+		yydebug = 1;
+	}
+	if(openSource(&cc.lex, argv[1]) != 0)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	t0 = now();
+	ok = !(rd ? rdParse(&cc) : yyparse(&cc.lex, &cc));
+	t = now() - t0;
+	closeSource(&cc.lex);
+	fclose(cc.out);
+	freeCompilation(&cc);
+	printf("%-10s %s %4zu bytes/value %9ld tokens %12zu value bytes shifted %8.3f s %12.0f tokens/s\n",
+		argc > 2 ? argv[2] : "parser", ok ? "ok  " : "FAIL", sizeof(YYSTYPE), ntok, ntok * sizeof(YYSTYPE),
+		t, ntok / t);
+	if(&yydebug != NULL && !rd)
+		printf("%-10s %ld reductions, %.2f per token\n", argc > 2 ? argv[2] : "parser", nred, (double)nred / ntok);
+	return !ok;
+}
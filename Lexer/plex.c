@@ -0,0 +1,194 @@
+/*
+	Parallel lexing of one large source file.
+	The mapped input is cut into chunks just after newlines. A cheap
+	sequential pre-scan that only visits '/' characters (via memchr) moves
+	any cut that falls inside a block comment to the end of that comment;
+	tokens never span lines and this language has no string literals, so
+	every chunk can then be lexed on its own. Worker threads take chunks
+	from a shared counter and run hscan() over them, and the per-chunk
+	token arrays are stitched in order. Tokens carry absolute byte
+	offsets, so nothing needs fixing up when the arrays are joined.
+
+	The result is handed to replay.c, so the parser reads it exactly like
+	a stream saved with --tokbin.
+
+	Include after replay.c and hscan.c; link with -pthread.
+*/
+#include <pthread.h>
+
+#define PLEX_MINCHUNK (1<<16)
+#define PLEX_CHUNKS_PER_THREAD 4
+
+typedef struct lexchunk
+{
+	char *start;
+	char *end;
+	TOKREC *rec;
+	size_t n;
+	size_t cap;
+}LEXCHUNK;
+
+typedef struct lexjob
+{
+	char *base;
+	LEXCHUNK *chunk;
+	int nchunk;
+	int next;
+}LEXJOB;
+
+static void lexChunk(char *base, LEXCHUNK *c)
+{
+	char *p = c->start;
+	HTOK t;
+	TOKREC *r;
+	c->n = 0;
+	c->cap = (c->end - c->start) / 4 + 16;
+	c->rec = (TOKREC*)malloc(c->cap * sizeof(TOKREC));
+	while(hscan(&p, c->end, &t) != 0)
+	{
+		if(c->n == c->cap)
+			c->rec = (TOKREC*)realloc(c->rec, (c->cap *= 2) * sizeof(TOKREC));
+		r = &c->rec[c->n++];
+		r->kind = t.code;
+		r->offset = t.start - base;
+		r->length = t.len;
+	}
+}
+
+static void* lexWorker(void *arg)
+{
+	LEXJOB *job = (LEXJOB*)arg;
+	int i;
+	while((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->nchunk)
+		lexChunk(job->base, &job->chunk[i]);
+	return NULL;
+}
+
+/* cuts [base, end) into at most k chunks that start outside any comment */
+static int splitChunks(char *base, char *end, int k, LEXCHUNK *c)
+{
+	char **cut = (char**)malloc((k+1) * sizeof(char*));
+	char *p, *q, *e;
+	int i, n = 1, b;
+	size_t len = end - base;
+	cut[0] = base;
+	for(i=1;i<k;i++)
+	{
+		p = base + len / k * i;
+		if(p <= cut[n-1])
+			continue;
+		q = (char*)memchr(p, '\n', end - p);
+		if(q == NULL || q + 1 >= end)
+			break;
+		cut[n++] = q + 1;
+	}
+	cut[n] = end;
+	/* pre-scan: push cuts that land inside block comments past the comment */
+	p = base;
+	b = 1;
+	while(b < n && (q = (char*)memchr(p, '/', end - p)) != NULL)
+	{
+		while(b < n && cut[b] <= q)
+			b++;
+		if(q + 1 < end && q[1] == '*')
+		{
+			e = skipBlockComment(q + 2, end);
+			for(;b < n && cut[b] < e;b++)
+				cut[b] = e;
+			p = e;
+		}
+		else if(q + 1 < end && q[1] == '/')
+		{
+			e = (char*)memchr(q, '\n', end - q);
+			p = e == NULL ? end : e;
+		}
+		else
+			p = q + 1;
+	}
+	for(i=0;i<n;i++)
+	{
+		c[i].start = cut[i];
+		c[i].end = cut[i+1];
+		c[i].rec = NULL;
+		c[i].n = 0;
+	}
+	free(cut);
+	return n;
+}
+
+/* lexes [base, base+len) with nthreads workers; returns the stitched tokens */
+TOKREC* lexParallel(char *base, size_t len, int nthreads, size_t *ntok)
+{
+	LEXJOB job;
+	LEXCHUNK *c;
+	pthread_t *tid;
+	TOKREC *out;
+	size_t total = 0, at = 0;
+	int i, k;
+	if(nthreads < 1)
+		nthreads = 1;
+	k = nthreads * PLEX_CHUNKS_PER_THREAD;
+	if(len / PLEX_MINCHUNK + 1 < (size_t)k)
+		k = len / PLEX_MINCHUNK + 1;
+	c = (LEXCHUNK*)malloc(k * sizeof(LEXCHUNK));
+	job.base = base;
+	job.chunk = c;
+	job.nchunk = splitChunks(base, base + len, k, c);
+	job.next = 0;
+	if(nthreads > job.nchunk)
+		nthreads = job.nchunk;
+	tid = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
+	/* chunks are taken from one queue, so any a thread could not be started for are lexed here */
+	for(i=1;i<nthreads;i++)
+		if(pthread_create(&tid[i], NULL, lexWorker, &job) != 0)
+		{
+			nthreads = i;
+			break;
+		}
+	lexWorker(&job);
+	for(i=1;i<nthreads;i++)
+		pthread_join(tid[i], NULL);
+	for(i=0;i<job.nchunk;i++)
+		total += c[i].n;
+	out = (TOKREC*)malloc((total ? total : 1) * sizeof(TOKREC));
+	for(i=0;i<job.nchunk;i++)
+	{
+		memcpy(out + at, c[i].rec, c[i].n * sizeof(TOKREC));
+		at += c[i].n;
+		free(c[i].rec);
+	}
+	free(c);
+	free(tid);
+	*ntok = total;
+	return out;
+}
+
+/*
+	Lexes path with nthreads workers and queues the result for yylex()
+	through replay.c. tokens.txt and the --tokbin stream are written from
+	the stitched array.
+*/
+int openSourceParallel(LEXER *lx, char *path, int nthreads)
+{
+	size_t len, n, i;
+	char *base = mapSource(&lx->src, path, &len);
+	TOKREC *rec;
+	if(base == NULL)
+		return -1;
+	lineTableSource(&lx->lines, base, len);
+	rec = lexParallel(base, len, nthreads, &n);
+	for(i=0;i<n;i++)
+	{
+		putTokenRecord(lx, rec[i].kind, rec[i].offset, rec[i].length);
+		if(lx->log.mode == TOKLOG_FULL)
+			addTokenToFile(&lx->log, kindname[rec[i].kind], rec[i].kind == JT_ID || rec[i].kind == JT_NUM ? internStr(&lx->names, intern(&lx->names, base + rec[i].offset, rec[i].length)) : spelling[rec[i].kind]);
+		else if(lx->log.mode == TOKLOG_SUMMARY)
+			addTokenToFile(&lx->log, kindname[rec[i].kind], "");
+	}
+	memset(&lx->replay, 0, sizeof(REPLAY));
+	lx->replay.map.rec = rec;
+	lx->replay.map.n = n;
+	lx->replay.owned = rec;
+	lx->replaying = 1;
+	return 0;
+}
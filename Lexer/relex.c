@@ -0,0 +1,204 @@
+/*
+	Incremental re-lexing for edited sources.
+	A TOKCACHE keeps a private copy of a file's text and its token array.
+	relexEdit() applies one edit (replace oldlen bytes at off with newlen
+	new bytes) and re-lexes only the damaged part:
+
+	- scanning restarts at the start of the token just before the edit,
+	  which is always outside any comment, so no scanner state is needed;
+	- new tokens are compared with the old tokens after the edit, shifted
+	  by the size change, and scanning stops at the first one that matches
+	  again, because from a token start onwards the text and therefore the
+	  tokens are identical;
+	- the old tokens in between are replaced and the tail only has its
+	  offsets adjusted.
+
+	The RELEX result says which token indices changed, so later phases can
+	update incrementally as well.
+
+	The caches live in a TOKCACHES list that the caller owns, one per
+	editor or watch loop, so nothing here is shared between threads.
+	relexcheck.c compares random edits with a full rescan.
+
+	Include after srcmap.c, tokstream.c and hscan.c.
+*/
+
+typedef struct tokcache
+{
+	char *path;
+	char *src;
+	size_t len;
+	size_t srccap;
+	TOKREC *rec;
+	size_t n;
+	size_t cap;
+	struct tokcache *next;
+}TOKCACHE;
+
+typedef struct relex
+{
+	size_t first;		/* index of the first changed token */
+	size_t oldcount;	/* tokens removed from there */
+	size_t newcount;	/* tokens inserted in their place */
+}RELEX;
+
+/* the open caches of one caller, found by path */
+typedef struct tokcaches
+{
+	TOKCACHE *head;
+}TOKCACHES;
+
+static void cachePut(TOKCACHE *c, size_t at, HTOK *t)
+{
+	if(at == c->cap)
+	{
+		c->cap = c->cap ? c->cap*2 : 1024;
+		c->rec = (TOKREC*)realloc(c->rec, c->cap * sizeof(TOKREC));
+	}
+	c->rec[at].kind = t->code;
+	c->rec[at].offset = t->start - c->src;
+	c->rec[at].length = t->len;
+}
+
+/* returns the cache for path in cs, lexing the file the first time */
+TOKCACHE* tokenCache(TOKCACHES *cs, char *path)
+{
+	TOKCACHE *c;
+	SRCMAP m = {NULL, 0, 0};
+	size_t len;
+	char *base, *p;
+	HTOK t;
+	for(c=cs->head;c!=NULL;c=c->next)
+		if(strcmp(c->path, path) == 0)
+			return c;
+	base = mapSource(&m, path, &len);
+	if(base == NULL)
+		return NULL;
+	c = (TOKCACHE*)calloc(1, sizeof(TOKCACHE));
+	c->path = strdup(path);
+	c->srccap = len + 1;
+	c->src = (char*)malloc(c->srccap);
+	memcpy(c->src, base, len);
+	c->len = len;
+	unmapSource(&m);
+	p = c->src;
+	while(hscan(&p, c->src + c->len, &t) != 0)
+	{
+		cachePut(c, c->n, &t);
+		c->n++;
+	}
+	c->next = cs->head;
+	cs->head = c;
+	return c;
+}
+
+/* first token that ends at or after off */
+static size_t firstTouching(TOKCACHE *c, size_t off)
+{
+	size_t lo = 0, hi = c->n, mid;
+	while(lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if(c->rec[mid].offset + c->rec[mid].length < off)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+int relexEdit(TOKCACHE *c, size_t off, size_t oldlen, char *text, size_t newlen, RELEX *res)
+{
+	long delta = (long)newlen - (long)oldlen;
+	size_t i0, j, k, oldend = off + oldlen;
+	TOKREC *old, *tail;
+	size_t ntail, nnew = 0, newcap = 16;
+	char *p;
+	HTOK t;
+	int synced = 0;
+	if(off > c->len || oldend > c->len)
+		return -1;
+
+	/* splice the text */
+	if(c->len + delta + 1 > c->srccap)
+	{
+		c->srccap = (c->len + delta + 1) * 2;
+		c->src = (char*)realloc(c->src, c->srccap);
+	}
+	memmove(c->src + off + newlen, c->src + oldend, c->len - oldend);
+	memcpy(c->src + off, text, newlen);
+	c->len += delta;
+
+	/* restart at the token before the edit; it may merge with the new text */
+	i0 = firstTouching(c, off);
+	if(i0 > 0)
+		i0--;
+	if(i0 > 0 && i0 < c->n)
+		p = c->src + c->rec[i0].offset;
+	else
+	{
+		/* nothing lies safely before the edit; start from the top */
+		i0 = 0;
+		p = c->src;
+	}
+
+	/* only old tokens wholly after the edit can resynchronise */
+	j = i0;
+	while(j < c->n && c->rec[j].offset < oldend)
+		j++;
+
+	old = c->rec;
+	tail = (TOKREC*)malloc(newcap * sizeof(TOKREC));
+	while(hscan(&p, c->src + c->len, &t) != 0)
+	{
+		while(j < c->n && (long)old[j].offset + delta < t.start - c->src)
+			j++;
+		if(j < c->n && (long)old[j].offset + delta == t.start - c->src
+			&& old[j].kind == t.code && old[j].length == (unsigned)t.len)
+		{
+			synced = 1;
+			break;
+		}
+		if(nnew == newcap)
+			tail = (TOKREC*)realloc(tail, (newcap *= 2) * sizeof(TOKREC));
+		tail[nnew].kind = t.code;
+		tail[nnew].offset = t.start - c->src;
+		tail[nnew].length = t.len;
+		nnew++;
+	}
+	if(!synced)
+		j = c->n;
+
+	/* old[i0..j) is replaced by tail[0..nnew); old[j..n) is shifted */
+	ntail = c->n - j;
+	if(i0 + nnew + ntail > c->cap)
+	{
+		c->cap = (i0 + nnew + ntail) * 2;
+		c->rec = (TOKREC*)realloc(c->rec, c->cap * sizeof(TOKREC));
+	}
+	memmove(c->rec + i0 + nnew, c->rec + j, ntail * sizeof(TOKREC));
+	memcpy(c->rec + i0, tail, nnew * sizeof(TOKREC));
+	for(k=i0+nnew;k<i0+nnew+ntail;k++)
+		c->rec[k].offset += delta;
+	free(tail);
+	res->first = i0;
+	res->oldcount = j - i0;
+	res->newcount = nnew;
+	c->n = i0 + nnew + ntail;
+	return 0;
+}
+
+void dropTokenCache(TOKCACHES *cs, TOKCACHE *c)
+{
+	TOKCACHE **pp;
+	for(pp=&cs->head;*pp!=NULL;pp=&(*pp)->next)
+		if(*pp == c)
+		{
+			*pp = c->next;
+			break;
+		}
+	free(c->path);
+	free(c->src);
+	free(c->rec);
+	free(c);
+}
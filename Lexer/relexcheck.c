@@ -0,0 +1,128 @@
+/*
+	Checks relex.c against a full rescan.
+	usage: ./relexcheck a.java [edits] [seed]
+	Applies random edits to the cached copy of the file, mostly inserting
+	or deleting pieces that change token boundaries (comment openers and
+	closers, newlines, names, numbers, operators). After each edit the
+	whole text is lexed again and the token arrays must match. The range
+	in RELEX is checked as well: tokens before first are the old ones, and
+	those after first+newcount are the old ones after first+oldcount moved
+	by the size of the edit.
+*/
+#include "srcmap.c"
+#include "tokstream.c"
+#include "utf8id.c"
+#include "hscan.c"
+#include "relex.c"
+
+static char *pieces[] = {
+	"/*", "*/", "//", "\n", " ", "x", "ab1", "_$", "42", "3.5", "0x1F",
+	"+", "=", "==", "(", ")", "{", "}", ";", "if", "while", "int", ".", "\xce\xbb"
+};
+
+static int sameToken(TOKREC *a, TOKREC *b, long delta)
+{
+	return a->kind == b->kind && (long)a->offset == (long)b->offset + delta && a->length == b->length;
+}
+
+/* full rescan of c's text; returns the token count */
+static size_t rescan(TOKCACHE *c, TOKREC **out, size_t *cap)
+{
+	char *p = c->src;
+	HTOK t;
+	size_t n = 0;
+	while(hscan(&p, c->src + c->len, &t) != 0)
+	{
+		if(n == *cap)
+			*out = (TOKREC*)realloc(*out, (*cap = *cap ? *cap*2 : 1024) * sizeof(TOKREC));
+		(*out)[n].kind = t.code;
+		(*out)[n].offset = t.start - c->src;
+		(*out)[n].length = t.len;
+		n++;
+	}
+	return n;
+}
+
+int main(int argc, char* argv[])
+{
+	TOKCACHES caches = {NULL};
+	TOKCACHE *c;
+	RELEX res;
+	TOKREC *before = NULL, *full = NULL;
+	size_t beforecap = 0, fullcap = 0, nbefore, nfull, off, oldlen, k;
+	long delta, edits = 1000, e, resynced = 0;
+	char *text;
+	(void)kindname;	/* hscan.c names tokens for the lexers only */
+	if(argc < 2)
+	{
+		printf("usage: %s source [edits] [seed]\n", argv[0]);
+		return 1;
+	}
+	if(argc > 2)
+		edits = atol(argv[2]);
+	srand(argc > 3 ? atoi(argv[3]) : 1);
+	if((c = tokenCache(&caches, argv[1])) == NULL)
+	{
+		printf("cannot open %s\n", argv[1]);
+		return 1;
+	}
+	if(tokenCache(&caches, argv[1]) != c)
+	{
+		printf("second lookup of %s made a new cache\n", argv[1]);
+		return 1;
+	}
+	for(e=0;e<edits;e++)
+	{
+		if(c->n > beforecap)
+			before = (TOKREC*)realloc(before, (beforecap = c->n * 2) * sizeof(TOKREC));
+		memcpy(before, c->rec, c->n * sizeof(TOKREC));
+		nbefore = c->n;
+		off = c->len ? (size_t)rand() % (c->len + 1) : 0;
+		oldlen = rand() % 3 == 0 ? (size_t)rand() % 8 : 0;
+		if(off + oldlen > c->len)
+			oldlen = c->len - off;
+		text = rand() % 4 == 0 ? "" : pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+		if(relexEdit(c, off, oldlen, text, strlen(text), &res) != 0)
+		{
+			printf("edit %ld: relexEdit refused %zu+%zu\n", e, off, oldlen);
+			return 1;
+		}
+		delta = (long)strlen(text) - (long)oldlen;
+		nfull = rescan(c, &full, &fullcap);
+		if(nfull != c->n)
+		{
+			printf("edit %ld at %zu: %zu tokens, rescan gives %zu\n", e, off, c->n, nfull);
+			return 1;
+		}
+		for(k=0;k<nfull;k++)
+			if(!sameToken(&c->rec[k], &full[k], 0))
+			{
+				printf("edit %ld at %zu: token %zu differs from rescan\n", e, off, k);
+				return 1;
+			}
+		if(res.first + res.oldcount > nbefore || nbefore - res.oldcount + res.newcount != c->n)
+		{
+			printf("edit %ld at %zu: bad range %zu -%zu +%zu\n", e, off, res.first, res.oldcount, res.newcount);
+			return 1;
+		}
+		for(k=0;k<res.first;k++)
+			if(!sameToken(&c->rec[k], &before[k], 0))
+			{
+				printf("edit %ld at %zu: token %zu before the range changed\n", e, off, k);
+				return 1;
+			}
+		for(k=res.first+res.oldcount;k<nbefore;k++)
+			if(!sameToken(&c->rec[k - res.oldcount + res.newcount], &before[k], delta))
+			{
+				printf("edit %ld at %zu: token %zu after the range was not just moved\n", e, off, k);
+				return 1;
+			}
+		if(res.first + res.oldcount < nbefore)
+			resynced++;
+	}
+	printf("%ld edits match a full rescan (%ld resynchronised early), %zu tokens, %zu bytes\n", edits, resynced, c->n, c->len);
+	dropTokenCache(&caches, c);
+	free(before);
+	free(full);
+	return caches.head == NULL ? 0 : 1;
+}
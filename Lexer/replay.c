@@ -0,0 +1,97 @@
+/*
+	Token replay.
+	A source file is lexed once (with --tokbin=FILE) and later phases feed
+	the saved stream to their parser instead of lexing the file again.
+	Identifier and number text is sliced out of the mapped source and
+	interned; every other token gets its fixed spelling.
+
+	Include after tokstream.c, srcmap.c, linetab.c and intern.c.
+*/
+#include "jtok.h"
+
+typedef struct replaytok
+{
+	int kind;
+	char *text;
+	int id;
+	unsigned offset;
+}REPLAYTOK;
+
+static char *spelling[JT_LAST+1] = {
+	['('] = "(", [')'] = ")", ['{'] = "{", ['}'] = "}", ['['] = "[", [']'] = "]",
+	['.'] = ".", [','] = ",", [';'] = ";", ['!'] = "!", ['~'] = "~", ['%'] = "%",
+	[JT_CLASS] = "class", [JT_PUBLIC] = "public", [JT_PRIVATE] = "private",
+	[JT_STATIC] = "static", [JT_VOID] = "void", [JT_INT] = "int", [JT_CHAR] = "char",
+	[JT_DOUBLE] = "double", [JT_IF] = "if", [JT_ELSE] = "else", [JT_NEW] = "new",
+	[JT_STRING] = "String", [JT_ARGS] = "args", [JT_FOR] = "for", [JT_MAIN] = "main",
+	[JT_INC] = "++", [JT_DEC] = "--", [JT_LOGOR] = "||", [JT_LOGAND] = "&&",
+	[JT_OR] = "|", [JT_AND] = "&", [JT_EQ] = "==", [JT_NEQ] = "!=", [JT_GTEQ] = ">=",
+	[JT_LTEQ] = "<=", [JT_ADD] = "+", [JT_SUB] = "-", [JT_MUL] = "*", [JT_DIV] = "/",
+	[JT_GT] = ">", [JT_LT] = "<", [JT_XOR] = "^", [JT_LS] = "<<", [JT_RS] = ">>",
+	[JT_ASSGN] = "=", [JT_MULASSGN] = "*=", [JT_DIVASSGN] = "/=", [JT_MODASSGN] = "%=",
+	[JT_ADDASSGN] = "+=", [JT_SUBASSGN] = "-=", [JT_ANDASSGN] = "&=",
+	[JT_XORASSGN] = "^=", [JT_ORASSGN] = "|=",
+};
+
+/* maps the token stream and the source it was lexed from into lx->replay and lx->src */
+int openReplay(LEXER *lx, char *tokpath, char *srcpath)
+{
+	size_t len;
+	TOKREC *last;
+	if(mapTokenStream(tokpath, &lx->replay.map) != 0)
+		return -1;
+	if(mapSource(&lx->src, srcpath, &len) == NULL)
+	{
+		unmapTokenStream(&lx->replay.map);
+		return -1;
+	}
+	/* a stream from a different or edited source would slice garbage */
+	last = lx->replay.map.n ? &lx->replay.map.rec[lx->replay.map.n-1] : NULL;
+	if(last != NULL && (size_t)last->offset + last->length > len)
+	{
+		unmapTokenStream(&lx->replay.map);
+		unmapSource(&lx->src);
+		return -1;
+	}
+	lineTableSource(&lx->lines, lx->src.base, lx->src.len);
+	lx->replay.next = 0;
+	lx->replaying = 1;
+	return 0;
+}
+
+/* fills t with the next token and returns its kind, 0 at the end */
+int nextReplay(LEXER *lx, REPLAYTOK *t)
+{
+	REPLAY *rp = &lx->replay;
+	TOKREC *r;
+	if(rp->next >= rp->map.n)
+	{
+		t->kind = 0;
+		return 0;
+	}
+	r = &rp->map.rec[rp->next++];
+	t->kind = r->kind;
+	t->offset = r->offset;
+	t->id = 0;
+	if((r->kind == JT_ID || r->kind == JT_NUM) && (size_t)r->offset + r->length <= lx->src.len)
+	{
+		t->id = intern(&lx->names, lx->src.base + r->offset, r->length);
+		t->text = internStr(&lx->names, t->id);
+	}
+	else if(r->kind >= 0 && r->kind <= JT_LAST && spelling[r->kind] != NULL)
+		t->text = spelling[r->kind];
+	else
+		t->text = "";
+	return t->kind;
+}
+
+void closeReplay(LEXER *lx)
+{
+	if(!lx->replaying)
+		return;
+	unmapTokenStream(&lx->replay.map);
+	free(lx->replay.owned);
+	lx->replay.owned = NULL;
+	unmapSource(&lx->src);
+	lx->replaying = 0;
+}
@@ -0,0 +1,77 @@
+/*
+	Memory-mapped source input.
+	The whole file is mapped copy-on-write with two zero bytes after it,
+	which is the layout yy_scan_buffer() wants, so flex scans the mapping
+	in place and yytext points straight into it instead of into flex's
+	own read buffer.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "lexer.h"
+
+/* maps fd; returns NULL when it is not a regular file (pipes, terminals) */
+char* mapSourceFd(SRCMAP *m, int fd, size_t *len)
+{
+	struct stat st;
+	size_t pg = sysconf(_SC_PAGESIZE);
+	char *base;
+	if(fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return NULL;
+	m->len = st.st_size;
+	m->maplen = (m->len + 2 + pg - 1) / pg * pg;
+	/* reserve len+2 zeroed bytes, then lay the file over the front of it */
+	base = (char*)mmap(NULL, m->maplen, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(base == MAP_FAILED)
+		return NULL;
+	if(m->len > 0 && mmap(base, m->len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		munmap(base, m->maplen);
+		return NULL;
+	}
+	m->base = base;
+	*len = m->len;
+	return base;
+}
+
+char* mapSource(SRCMAP *m, const char *path, size_t *len)
+{
+	char *p;
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return NULL;
+	p = mapSourceFd(m, fd, len);
+	close(fd);
+	return p;
+}
+
+void unmapSource(SRCMAP *m)
+{
+	if(m->base != NULL)
+		munmap(m->base, m->maplen);
+	m->base = NULL;
+	m->len = m->maplen = 0;
+}
+
+/*
+	Finds the end of a block comment whose body starts at p and returns the
+	position just past its closing star-slash, or end if it is unterminated.
+	Both searches go through memchr, which scans a vector at a time, so long
+	comments and license headers cost about as much as a memory copy.
+*/
+char* skipBlockComment(char *p, char *end)
+{
+	char *q = p;
+	while((q = (char*)memchr(q, '*', end - q)) != NULL)
+	{
+		if(q + 1 < end && q[1] == '/')
+			break;
+		q++;
+	}
+	return q == NULL ? end : q + 2;
+}
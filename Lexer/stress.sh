@@ -0,0 +1,77 @@
+#!/bin/sh
+# Stress test for long programs.
+# usage: Lexer/stress.sh [statements]	(default 1000000)
+# Writes a main() with that many statements (javagen -n) and runs every
+# parser on it under a 1 MB C stack: the AST phase with bison and with
+# --rd, the ICG phase, and the symbol table when lex is installed. The
+# optimizer reads "go to" where the ICG phase writes "goto", so it gets
+# as many instructions of javagen -t output instead. Each run must
+# report success. The AST phase must also keep its tree shallow: the
+# depth --stats prints follows block nesting and expression size, not
+# the number of statements.
+# Everything is built and written in a temporary folder that is removed
+# at the end; the outputs of a million statements take about 1.2 GB.
+
+N=${1:-1000000}
+MAXDEPTH=64
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+W=$(mktemp -d) || exit 1
+trap 'rm -rf "$W"' EXIT INT TERM
+fail=0
+
+# name, output file, text a successful run prints
+check()
+{
+	if grep -q "$3" "$2"; then
+		echo "$1: ok"
+	else
+		echo "$1: FAILED"
+		tail -5 "$2"
+		fail=1
+	fi
+}
+
+cp -r "$ROOT/Lexer" "$ROOT/Absolute_Syntax_Tree_Gen" "$ROOT/Intermediate_Code_Gen" \
+	"$ROOT/Optimized_Code_Gen" "$ROOT/Symbol_Table_Gen" "$W" || exit 1
+gcc -O2 "$W/Lexer/javagen.c" -o "$W/javagen" || exit 1
+"$W/javagen" -n "$N" > "$W/stress.java" || exit 1
+echo "$N statements, $(wc -c < "$W/stress.java") bytes"
+
+cd "$W/Absolute_Syntax_Tree_Gen" || exit 1
+bison -y -d sym.y 2>/dev/null && gcc -O2 -I. -I../Lexer -pthread ../Lexer/hlex.c y.tab.c rdparse.c -o ast || exit 1
+for p in bison --rd; do
+	[ $p = bison ] && opt= || opt=$p
+	(ulimit -s 1024; ./ast ../stress.java --tokens=off --stats $opt) > out 2>&1
+	check "AST $p" out "Parsing succesful"
+	depth=$(sed -n 's/^AST: .*, depth \([0-9]*\)$/\1/p' out)
+	if [ -z "$depth" ] || [ "$depth" -gt $MAXDEPTH ]; then
+		echo "AST $p: tree depth ${depth:-not reported}, limit $MAXDEPTH"
+		fail=1
+	else
+		echo "AST $p: tree depth $depth"
+	fi
+	rm -f AST.txt
+done
+
+cd "$W/Intermediate_Code_Gen" || exit 1
+bison -y -d if.y 2>/dev/null && gcc -O2 -I. -I../Lexer -pthread ../Lexer/hlex.c y.tab.c -o icg || exit 1
+(ulimit -s 1024; ./icg ../stress.java --tokens=off) > out 2>&1
+check ICG out "Parsing successful"
+rm -f icg.txt
+
+cd "$W/Optimized_Code_Gen" || exit 1
+"$W/javagen" -t -n "$N" > icg.txt || exit 1
+bison -y -d optimicons.y 2>/dev/null && gcc -O2 -I. -I../Lexer tacread.c y.tab.c -o opt || exit 1
+(ulimit -s 1024; ./opt) > out 2>&1
+check Optimizer out "Optimised ICG Generated"
+rm -f icg.txt Optimised.txt
+
+if command -v lex > /dev/null 2>&1; then
+	cd "$W/Symbol_Table_Gen" || exit 1
+	lex lexer.l && bison -y -d parser.y 2>/dev/null && gcc -O2 -I. -I../Lexer lex.yy.c y.tab.c -o symtab || exit 1
+	(ulimit -s 1024; ./symtab ../stress.java) > out 2>&1
+	check "Symbol table" out accepted
+else
+	echo "Symbol table: skipped, lex is not installed"
+fi
+exit $fail
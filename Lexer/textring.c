@@ -0,0 +1,63 @@
+/*
+	Token text ring for streaming input.
+	Identifier text is copied into a fixed ring buffer instead of being
+	strdup'd per token. A copy stays valid until the parser calls
+	releaseText(), which it does each time it finishes a statement. At
+	that point every name read so far has been used by the symbol table
+	actions, except possibly the lookahead token. releaseText() keeps the
+	most recent text, so the lookahead survives.
+
+	The ring never grows. If one statement needs more than TEXTRING_SIZE
+	bytes of names, the extra names are interned instead. That memory is
+	bounded by the number of distinct names, not by the size of the input.
+
+	Include after intern.c.
+*/
+#ifndef TEXTRING_SIZE
+#define TEXTRING_SIZE (1<<16)
+#endif
+
+typedef struct textring
+{
+	char buf[TEXTRING_SIZE];
+	size_t head;		/* absolute write position */
+	size_t tail;		/* absolute start of the oldest live text */
+	size_t last;		/* absolute start of the newest text */
+	size_t peak;		/* most live bytes seen */
+	size_t spilled;		/* names that had to be interned */
+}TEXTRING;
+
+/* copies s[0..len) into lx's ring; the copy lives until the next releaseText() but one */
+char* ringText(LEXER *lx, const char *s, int len)
+{
+	TEXTRING *r = lx->ring;
+	size_t need = len + 1, pos, pad = 0;
+	char *p;
+	if(r == NULL)
+		r = lx->ring = (TEXTRING*)calloc(1, sizeof(TEXTRING));
+	pos = r->head % TEXTRING_SIZE;
+	/* texts are contiguous: skip the end of the ring if s does not fit there */
+	if(pos + need > TEXTRING_SIZE)
+		pad = TEXTRING_SIZE - pos;
+	if(r->head - r->tail + pad + need > TEXTRING_SIZE)
+	{
+		r->spilled++;
+		return internStr(&lx->names, intern(&lx->names, s, len));
+	}
+	r->head += pad;
+	r->last = r->head;
+	p = r->buf + r->head % TEXTRING_SIZE;
+	memcpy(p, s, len);
+	p[len] = '\0';
+	r->head += need;
+	if(r->head - r->tail > r->peak)
+		r->peak = r->head - r->tail;
+	return p;
+}
+
+/* frees every text but the newest, which may belong to the parser's lookahead */
+void releaseText(LEXER *lx)
+{
+	if(lx->ring != NULL)
+		lx->ring->tail = lx->ring->last;
+}
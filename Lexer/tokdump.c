@@ -0,0 +1,58 @@
+/*
+	Prints a binary token stream written with --tokbin.
+	usage: ./tokdump tokens.bin [a.java]
+	With the source file the token text and its line:col are shown as
+	well, sliced out of the mapped source rather than stored in the stream.
+*/
+#include "tokstream.c"
+#include "linetab.c"
+
+int main(int argc, char* argv[])
+{
+	TOKMAP m;
+	LINETAB lines = {NULL, 0, NULL, NULL, NULL, 0, 0, 0};
+	char *src = NULL;
+	size_t srclen = 0;
+	size_t i;
+	if(argc < 2)
+	{
+		printf("usage: %s tokens.bin [source]\n", argv[0]);
+		return 1;
+	}
+	if(mapTokenStream(argv[1], &m) != 0)
+	{
+		printf("%s: not a token stream\n", argv[1]);
+		return 1;
+	}
+	if(argc > 2)
+	{
+		struct stat st;
+		int fd = open(argv[2], O_RDONLY);
+		if(fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			srclen = st.st_size;
+			src = (char*)mmap(NULL, srclen, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(src == MAP_FAILED)
+				src = NULL;
+			else
+				lineTableSource(&lines, src, srclen);
+		}
+		if(fd >= 0)
+			close(fd);
+	}
+	for(i=0;i<m.n;i++)
+	{
+		TOKREC *r = &m.rec[i];
+		printf("%d\t%u\t%u", r->kind, r->offset, r->length);
+		if(src != NULL && (size_t)r->offset + r->length <= srclen)
+		{
+			unsigned col, line = offsetLine(&lines, r->offset, &col);
+			printf("\t%u:%u\t%.*s", line, col, (int)r->length, src + r->offset);
+		}
+		printf("\n");
+	}
+	if(src != NULL)
+		munmap(src, srclen);
+	unmapTokenStream(&m);
+	return 0;
+}
@@ -0,0 +1,88 @@
+/*
+	Token log used by sym.l.
+	One tokens.txt writer is opened per compilation and block buffered,
+	instead of an fopen/fclose pair for every token.
+
+	TOKLOG_FULL		"Kind : text" line per token (old behaviour)
+	TOKLOG_SUMMARY	only a count per token kind, written on close
+	TOKLOG_OFF		nothing is written
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lexer.h"
+
+#define TOKLOG_BUFSIZE (1<<16)
+
+/* parses the value of a --tokens=off|summary|full switch; -1 for anything else */
+int tokenLogMode(char *s)
+{
+	if(strcmp(s,"off")==0)
+		return TOKLOG_OFF;
+	if(strcmp(s,"summary")==0)
+		return TOKLOG_SUMMARY;
+	if(strcmp(s,"full")==0)
+		return TOKLOG_FULL;
+	return -1;
+}
+
+void openTokenLog(TOKLOG *tl, int mode)
+{
+	tl->mode = mode;
+	tl->nkinds = 0;
+	if(mode == TOKLOG_OFF)
+		return;
+	tl->fp = fopen("tokens.txt", "a");
+	if(tl->fp == NULL)
+	{
+		printf("Error!");
+		exit(1);
+	}
+	tl->buf = (char*)malloc(TOKLOG_BUFSIZE);
+	setvbuf(tl->fp, tl->buf, _IOFBF, TOKLOG_BUFSIZE);
+}
+
+static void countToken(TOKLOG *tl, char *t)
+{
+	int i;
+	/* kinds are string literals in sym.l, so a pointer compare almost always hits */
+	for(i=0;i<tl->nkinds;i++)
+		if(tl->kind[i] == t || strcmp(tl->kind[i],t)==0)
+		{
+			tl->count[i]++;
+			return;
+		}
+	if(tl->nkinds == TOKLOG_MAXKINDS)
+		return;
+	tl->kind[tl->nkinds] = t;
+	tl->count[tl->nkinds++] = 1;
+}
+
+void addTokenToFile(TOKLOG *tl, char *t, char *s)
+{
+	if(tl->mode == TOKLOG_FULL)
+	{
+		if(tl->fp == NULL)
+			openTokenLog(tl, TOKLOG_FULL);
+		fputs(t, tl->fp);
+		fputs(" : ", tl->fp);
+		fputs(s, tl->fp);
+		putc('\n', tl->fp);
+	}
+	else if(tl->mode == TOKLOG_SUMMARY)
+		countToken(tl, t);
+}
+
+void closeTokenLog(TOKLOG *tl)
+{
+	int i;
+	if(tl->fp == NULL)
+		return;
+	if(tl->mode == TOKLOG_SUMMARY)
+		for(i=0;i<tl->nkinds;i++)
+			fprintf(tl->fp,"%s : %ld\n",tl->kind[i],tl->count[i]);
+	fclose(tl->fp);
+	tl->fp = NULL;
+	free(tl->buf);
+	tl->buf = NULL;
+}
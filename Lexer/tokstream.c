@@ -0,0 +1,127 @@
+/*
+	Binary token stream.
+	A 16 byte header followed by one fixed width, 12 byte TOKREC per token,
+	so later phases and tools can mmap the file and index tokens directly
+	instead of re-lexing the source or re-parsing tokens.txt.
+
+	kind	token code from y.tab.h (or the character for single char tokens)
+	offset	byte offset of the token in the source file
+	length	length of the token text in bytes
+
+	Lines are not stored; linetab.c recovers them from the offset.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lexer.h"
+
+#define TOKSTREAM_MAGIC "JTOK"
+#define TOKSTREAM_VERSION 2
+#define TOKSTREAM_BATCH 4096
+
+typedef struct tokhdr
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t recsize;
+	uint32_t reserved;
+}TOKHDR;
+
+typedef struct tokwriter
+{
+	FILE *fp;
+	int n;
+	TOKREC batch[TOKSTREAM_BATCH];
+}TOKWRITER;
+
+/* starts writing the tokens lx scans to path */
+int openTokenStream(LEXER *lx, char *path)
+{
+	TOKHDR h;
+	FILE *f = fopen(path, "wb");
+	if(f == NULL)
+		return -1;
+	memcpy(h.magic, TOKSTREAM_MAGIC, 4);
+	h.version = TOKSTREAM_VERSION;
+	h.recsize = sizeof(TOKREC);
+	h.reserved = 0;
+	fwrite(&h, sizeof(h), 1, f);
+	lx->tokw = (TOKWRITER*)malloc(sizeof(TOKWRITER));
+	lx->tokw->fp = f;
+	lx->tokw->n = 0;
+	return 0;
+}
+
+void putTokenRecord(LEXER *lx, int kind, unsigned offset, unsigned length)
+{
+	TOKWRITER *w = lx->tokw;
+	TOKREC *r;
+	if(w == NULL)
+		return;
+	if(w->n == TOKSTREAM_BATCH)
+	{
+		fwrite(w->batch, sizeof(TOKREC), w->n, w->fp);
+		w->n = 0;
+	}
+	r = &w->batch[w->n++];
+	r->kind = kind;
+	r->offset = offset;
+	r->length = length;
+}
+
+void closeTokenStream(LEXER *lx)
+{
+	TOKWRITER *w = lx->tokw;
+	if(w == NULL)
+		return;
+	fwrite(w->batch, sizeof(TOKREC), w->n, w->fp);
+	fclose(w->fp);
+	free(w);
+	lx->tokw = NULL;
+}
+
+/* maps a token stream read-only; returns 0 on success */
+int mapTokenStream(const char *path, TOKMAP *m)
+{
+	struct stat st;
+	TOKHDR *h;
+	int fd = open(path, O_RDONLY);
+	memset(m, 0, sizeof(TOKMAP));
+	if(fd < 0)
+		return -1;
+	if(fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(TOKHDR))
+	{
+		close(fd);
+		return -1;
+	}
+	m->size = st.st_size;
+	m->base = mmap(NULL, m->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(m->base == MAP_FAILED)
+	{
+		m->base = NULL;
+		return -1;
+	}
+	h = (TOKHDR*)m->base;
+	if(memcmp(h->magic, TOKSTREAM_MAGIC, 4) != 0 || h->version != TOKSTREAM_VERSION || h->recsize != sizeof(TOKREC))
+	{
+		munmap(m->base, m->size);
+		m->base = NULL;
+		return -1;
+	}
+	m->rec = (TOKREC*)((char*)m->base + sizeof(TOKHDR));
+	m->n = (m->size - sizeof(TOKHDR)) / sizeof(TOKREC);
+	return 0;
+}
+
+void unmapTokenStream(TOKMAP *m)
+{
+	if(m->base != NULL)
+		munmap(m->base, m->size);
+	memset(m, 0, sizeof(TOKMAP));
+}
@@ -0,0 +1,16 @@
+/*
+	Semantic value of a token in sym.y and if.y.
+	Both grammars declare a %union with a TOKVAL member named tok, which
+	is all the shared lexers fill in. Fixed spellings get their id from
+	internToken(), so a keyword costs one table lookup. Numbers keep their decoded value in
+	numlit.c's cache, keyed by the interned spelling.
+*/
+#ifndef TOKVAL_H
+#define TOKVAL_H
+typedef struct tokval
+{
+	char *v;		/* spelling: interned for names and numbers, a constant otherwise */
+	int id;			/* interned id of the spelling, for every token */
+	unsigned loc;	/* byte offset of the first character */
+}TOKVAL;
+#endif
@@ -0,0 +1,233 @@
+/*
+	Java identifiers: ASCII letters, digits, '_' and '$', plus non-ASCII
+	letters, currency symbols and combining marks written in UTF-8.
+	identEnd() is the scanners' fast path. It tests 32 bytes at a time
+	with AVX2, 16 with SSE2 or one at a time elsewhere, and only decodes
+	UTF-8 when it reaches a byte with the high bit set. The code point is
+	then looked up in idstart[] or idpart[] by binary search. The tables
+	cover the common scripts rather than the whole Unicode database.
+	Malformed UTF-8 (overlong forms, surrogates, truncated sequences)
+	never belongs to an identifier.
+*/
+#include <string.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+typedef struct idrange
+{
+	unsigned lo;
+	unsigned hi;
+}IDRANGE;
+
+/* ASCII: 1 = may continue an identifier, 3 = may also start one */
+static const unsigned char idascii[128] = {
+	['0' ... '9'] = 1,
+	['A' ... 'Z'] = 3,
+	['a' ... 'z'] = 3,
+	['_'] = 3, ['$'] = 3,
+};
+
+/* letters, letter numbers, currency symbols and connector punctuation */
+static const IDRANGE idstart[] = {
+	{0x00A2, 0x00A5}, {0x00AA, 0x00AA}, {0x00B5, 0x00B5}, {0x00BA, 0x00BA},
+	{0x00C0, 0x00D6}, {0x00D8, 0x00F6}, {0x00F8, 0x02C1}, {0x02C6, 0x02D1},
+	{0x02E0, 0x02E4}, {0x02EC, 0x02EC}, {0x02EE, 0x02EE},
+	{0x0370, 0x0374}, {0x0376, 0x0377}, {0x037A, 0x037D}, {0x037F, 0x037F},
+	{0x0386, 0x0386}, {0x0388, 0x038A}, {0x038C, 0x038C}, {0x038E, 0x03A1},
+	{0x03A3, 0x03F5}, {0x03F7, 0x0481}, {0x048A, 0x052F},
+	{0x0531, 0x0556}, {0x0559, 0x0559}, {0x0560, 0x0588}, {0x058F, 0x058F},
+	{0x05D0, 0x05EA}, {0x05EF, 0x05F2},
+	{0x0620, 0x064A}, {0x066E, 0x066F}, {0x0671, 0x06D3}, {0x06D5, 0x06D5},
+	{0x06E5, 0x06E6}, {0x06EE, 0x06EF}, {0x06FA, 0x06FC}, {0x06FF, 0x06FF},
+	{0x0904, 0x0939}, {0x093D, 0x093D}, {0x0950, 0x0950}, {0x0958, 0x0961},
+	{0x0971, 0x0980},
+	{0x0E01, 0x0E30}, {0x0E32, 0x0E33}, {0x0E3F, 0x0E46},
+	{0x10A0, 0x10C5}, {0x10D0, 0x10FA}, {0x10FC, 0x1248},
+	{0x1E00, 0x1F15}, {0x1F18, 0x1F1D}, {0x1F20, 0x1F45}, {0x1F48, 0x1F4D},
+	{0x1F50, 0x1F57}, {0x1F59, 0x1F59}, {0x1F5B, 0x1F5B}, {0x1F5D, 0x1F5D},
+	{0x1F5F, 0x1F7D}, {0x1F80, 0x1FB4}, {0x1FB6, 0x1FBC}, {0x1FBE, 0x1FBE},
+	{0x1FC2, 0x1FC4}, {0x1FC6, 0x1FCC}, {0x1FD0, 0x1FD3}, {0x1FD6, 0x1FDB},
+	{0x1FE0, 0x1FEC}, {0x1FF2, 0x1FF4}, {0x1FF6, 0x1FFC},
+	{0x203F, 0x2040}, {0x2054, 0x2054}, {0x2071, 0x2071}, {0x207F, 0x207F},
+	{0x2090, 0x209C}, {0x20A0, 0x20C0},
+	{0x2102, 0x2102}, {0x2107, 0x2107}, {0x210A, 0x2113}, {0x2115, 0x2115},
+	{0x2119, 0x211D}, {0x2124, 0x2124}, {0x2126, 0x2126}, {0x2128, 0x2128},
+	{0x212A, 0x212D}, {0x212F, 0x2139}, {0x2160, 0x2188},
+	{0x3005, 0x3007}, {0x3021, 0x3029}, {0x3031, 0x3035}, {0x3038, 0x303C},
+	{0x3041, 0x3096}, {0x309D, 0x309F}, {0x30A1, 0x30FA}, {0x30FC, 0x30FF},
+	{0x3105, 0x312F}, {0x3131, 0x318E},
+	{0x3400, 0x4DBF}, {0x4E00, 0xA48C}, {0xAC00, 0xD7A3},
+	{0xF900, 0xFA6D}, {0xFB00, 0xFB06}, {0xFE33, 0xFE34}, {0xFE4D, 0xFE4F},
+	{0xFE69, 0xFE69}, {0xFF04, 0xFF04}, {0xFF21, 0xFF3A}, {0xFF3F, 0xFF3F},
+	{0xFF41, 0xFF5A}, {0xFF66, 0xFFBE}, {0xFFE0, 0xFFE1}, {0xFFE5, 0xFFE6},
+	{0x10000, 0x1000B}, {0x1D400, 0x1D6A5},
+	{0x20000, 0x2A6DF}, {0x2A700, 0x2EBE0}, {0x30000, 0x3134A},
+};
+
+/* combining marks and non-ASCII digits, which may not start an identifier */
+static const IDRANGE idpart[] = {
+	{0x0300, 0x036F}, {0x0483, 0x0487}, {0x0591, 0x05BD}, {0x05BF, 0x05BF},
+	{0x05C1, 0x05C2}, {0x05C4, 0x05C5}, {0x05C7, 0x05C7}, {0x0610, 0x061A},
+	{0x064B, 0x0669}, {0x0670, 0x0670}, {0x06D6, 0x06DC}, {0x06DF, 0x06E4},
+	{0x06E7, 0x06E8}, {0x06EA, 0x06ED}, {0x06F0, 0x06F9},
+	{0x0900, 0x0903}, {0x093A, 0x093C}, {0x093E, 0x094F}, {0x0951, 0x0957},
+	{0x0962, 0x0963}, {0x0966, 0x096F},
+	{0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x0E50, 0x0E59},
+	{0x200C, 0x200D}, {0x20D0, 0x20F0}, {0x302A, 0x302F}, {0x3099, 0x309A},
+	{0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0xFF10, 0xFF19},
+};
+
+static int inRanges(unsigned c, const IDRANGE *r, int n)
+{
+	int lo = 0, hi = n - 1, mid;
+	while(lo <= hi)
+	{
+		mid = (lo + hi) / 2;
+		if(c < r[mid].lo)
+			hi = mid - 1;
+		else if(c > r[mid].hi)
+			lo = mid + 1;
+		else
+			return 1;
+	}
+	return 0;
+}
+
+/* decodes one UTF-8 sequence at p into *cp; returns its length, or 0 if it is malformed */
+int utf8Decode(const char *s, const char *end, unsigned *cp)
+{
+	const unsigned char *p = (const unsigned char*)s;
+	unsigned c = p[0];
+	int n, i;
+	if(c < 0x80)
+	{
+		*cp = c;
+		return 1;
+	}
+	if(c < 0xC2)
+		return 0;
+	else if(c < 0xE0)
+	{
+		n = 2;
+		c &= 0x1F;
+	}
+	else if(c < 0xF0)
+	{
+		n = 3;
+		c &= 0x0F;
+	}
+	else if(c < 0xF5)
+	{
+		n = 4;
+		c &= 0x07;
+	}
+	else
+		return 0;
+	if(end - s < n)
+		return 0;
+	for(i=1;i<n;i++)
+	{
+		if((p[i] & 0xC0) != 0x80)
+			return 0;
+		c = c << 6 | (p[i] & 0x3F);
+	}
+	if((n == 3 && c < 0x800) || (n == 4 && (c < 0x10000 || c > 0x10FFFF)) || (c >= 0xD800 && c <= 0xDFFF))
+		return 0;
+	*cp = c;
+	return n;
+}
+
+/* length of the non-ASCII identifier character at p, 0 if it is not one; start asks for a first character */
+int utf8IdentChar(const char *p, const char *end, int start)
+{
+	unsigned c;
+	int n = utf8Decode(p, end, &c);
+	if(n < 2)
+		return 0;
+	if(inRanges(c, idstart, sizeof(idstart)/sizeof(idstart[0])))
+		return n;
+	if(!start && inRanges(c, idpart, sizeof(idpart)/sizeof(idpart[0])))
+		return n;
+	return 0;
+}
+
+#if defined(__SSE2__)
+/* bit i set when byte i of v is an ASCII letter, digit, '_' or '$' */
+static inline unsigned identMask16(__m128i v)
+{
+	__m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+	/* bytes >= 0x80 are negative here, so they fail both ranges */
+	__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a'-1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z'+1)));
+	__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0'-1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9'+1)));
+	__m128i extra = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+	return (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), extra));
+}
+#endif
+
+#if defined(__AVX2__)
+static inline unsigned identMask32(__m256i v)
+{
+	__m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+	__m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z'+1), lower));
+	__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0'-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9'+1), v));
+	__m256i extra = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('$')));
+	return (unsigned)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(alpha, digit), extra));
+}
+#endif
+
+/* first byte at or after p that is not an ASCII identifier character */
+static inline const char* asciiIdentEnd(const char *p, const char *end)
+{
+	unsigned m;
+#if defined(__AVX2__)
+	while(end - p >= 32)
+	{
+		m = ~identMask32(_mm256_loadu_si256((const __m256i*)p));
+		if(m != 0)
+			return p + __builtin_ctz(m);
+		p += 32;
+	}
+#endif
+#if defined(__SSE2__)
+	while(end - p >= 16)
+	{
+		m = ~identMask16(_mm_loadu_si128((const __m128i*)p)) & 0xFFFF;
+		if(m != 0)
+			return p + __builtin_ctz(m);
+		p += 16;
+	}
+#endif
+	(void)m;
+	while(p < end && (unsigned char)*p < 0x80 && idascii[(unsigned char)*p])
+		p++;
+	return p;
+}
+
+/* end of the identifier whose first character ends just before p */
+const char* identEnd(const char *p, const char *end)
+{
+	int n;
+	for(;;)
+	{
+		p = asciiIdentEnd(p, end);
+		if(p >= end || (unsigned char)*p < 0x80 || (n = utf8IdentChar(p, end, 0)) == 0)
+			return p;
+		p += n;
+	}
+}
+
+/* length of the longest identifier at the start of s[0..len), 0 if s does not start one */
+int identLength(const char *s, int len)
+{
+	int n;
+	if(len <= 0)
+		return 0;
+	if((unsigned char)*s < 0x80)
+		n = idascii[(unsigned char)*s] == 3;
+	else
+		n = utf8IdentChar(s, s + len, 1);
+	if(n == 0)
+		return 0;
+	return identEnd(s + n, s + len) - s;
+}
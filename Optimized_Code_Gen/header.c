@@ -0,0 +1,27 @@
+#include "../Lexer/numlit.h"
+#include "../Lexer/lexer.h"
+typedef struct tacval
+{
+	char *s;		/* token text */
+	int id;			/* interned id of a name or number, 0 for operators */
+	NUMVAL num;		/* decoded value of a T_NUMBER */
+}TACVAL;
+
+/* what is known about each name, indexed by its interned id */
+typedef struct symbol_table_node
+{
+	int known;
+	NUMVAL value;
+}NODE;
+
+/*
+	Everything one run of the optimizer reads and writes. The parser is
+	pure and gets its COMPILATION from yyparse()'s arguments.
+*/
+typedef struct compilation
+{
+	LEXER lex;
+	FILE *opt;			/* Optimised.txt */
+	NODE *table;
+	int tablecap;
+}COMPILATION;
@@ -2,25 +2,30 @@
 	#include <stdio.h>
 	#include <string.h>
 	#include<stdlib.h>
-	void yyerror(const char *);
-	#define YYSTYPE char*
-	FILE *yyin;
-	int yylex();
-	extern int line;
-	FILE *opt;
-
-	typedef struct symbol_table_node
-	{
-		char name[30];
-		char value[30];
-	}NODE;
-
-	NODE table[100];
-	int top = -1;
-	void add_or_update(char*,char*);
-	char* getVal(char*);
-	char* calculate(char*,char*,char*);
+	#include <limits.h>
+	#include "header.c"
+	void yyerror(LEXER *lx, COMPILATION *cc, const char *);
+	#define YYSTYPE TACVAL
+	int openSource(LEXER *lx, char *path);
+	void closeSource(LEXER *lx);
+	void initLexer(LEXER *lx);
+	void freeLexer(LEXER *lx);
+	unsigned offsetLine(LINETAB *lt, unsigned off, unsigned *col);
+
+	void add_or_update(COMPILATION*,int,NUMVAL*);
+	NUMVAL* getVal(COMPILATION*,int);
+	int calculate(char*,NUMVAL*,NUMVAL*,NUMVAL*);
+	void fold(COMPILATION*,TACVAL*,TACVAL*,char*,TACVAL*);
+	void printNumber(FILE*,NUMVAL*);
 %}
+/* pure: the scanner's state and the constant table are yyparse()'s arguments */
+%define api.pure full
+%param {LEXER *lx}
+%parse-param {COMPILATION *cc}
+%code provides
+{
+	int yylex(YYSTYPE *lval, LEXER *lx);
+}
 
 %error-verbose
 
@@ -29,49 +34,38 @@
 
 %%
 supreme_start
-	:start supreme_start
+	:supreme_start start
 	|start
 	;
 
 start
 	:T_ID '=' T_NUMBER  {
-									add_or_update($1,$3);
-									fprintf(opt,"%s = %s\n",$1,$3);
+									add_or_update(cc,$1.id,&$3.num);
+									fprintf(cc->opt,"%s = %s\n",$1.s,$3.s);
 								}
 	|T_ID '=' T_ID {
-										add_or_update($1,getVal($3));
-										fprintf(opt,"%s = %s\n",$1,getVal($3));
+										NUMVAL *v = getVal(cc,$3.id);
+										add_or_update(cc,$1.id,v);
+										fprintf(cc->opt,"%s = ",$1.s);
+										if(v != NULL)
+											printNumber(cc->opt,v);
+										else
+											fputs($3.s,cc->opt);
+										fputc('\n',cc->opt);
 
 									}
-	|T_ID '=' T_ID opr T_ID {
-														add_or_update($1,calculate($4,getVal($3),getVal($5)));
-														fprintf(opt,"%s = %s\n",$1,calculate($4,getVal($3),getVal($5)));
-
-													}
-	|T_ID '=' T_NUMBER opr T_ID		{
-														add_or_update($1,calculate($4,$3,getVal($5)));
-														fprintf(opt,"%s = %s\n",$1,calculate($4,$3,getVal($5)));
-
-													}
-	|T_ID '=' T_ID opr T_NUMBER		{
-														add_or_update($1,calculate($4,getVal($3),$5));
-														fprintf(opt,"%s = %s\n",$1,calculate($4,getVal($3),$5));
-
-													}
-	|T_ID '=' T_NUMBER opr T_NUMBER			{
-
-														add_or_update($1,calculate($4,$3,$5));
-														fprintf(opt,"%s = %s\n",$1,calculate($4,$3,$5));
-
-													}
-	|T_GOTO T_ID {fprintf(opt,"%s %s\n",$1,$2);}
-	|T_GOTO T_STOP {fprintf(opt,"%s %s\n",$1,$2);}
-	|T_IF T_ID T_GOTO T_ID {fprintf(opt,"%s %s %s %s\n",$1,$2,$3,$4);}
-	|T_ID':' {fprintf(opt,"%s:\n",$1);}
-	|T_START {fprintf(opt,"%s\n",$1);}
-	|T_STOP   {fprintf(opt,"%s\n",$1);}
-	|T_ID '=' T_ID '[' T_ID ']' {fprintf(opt,"%s %s %s%s%s%s\n",$1,$2,$3,$4,$5,$6);}
-	|T_ID '[' T_ID ']' '=' T_ID {fprintf(opt,"%s%s%s%s %s %s",$1,$2,$3,$4,$5,$6);}
+	|T_ID '=' T_ID opr T_ID {fold(cc,&$1,&$3,$4.s,&$5);}
+	|T_ID '=' T_NUMBER opr T_ID		{fold(cc,&$1,&$3,$4.s,&$5);}
+	|T_ID '=' T_ID opr T_NUMBER		{fold(cc,&$1,&$3,$4.s,&$5);}
+	|T_ID '=' T_NUMBER opr T_NUMBER			{fold(cc,&$1,&$3,$4.s,&$5);}
+	|T_GOTO T_ID {fprintf(cc->opt,"%s %s\n",$1.s,$2.s);}
+	|T_GOTO T_STOP {fprintf(cc->opt,"%s %s\n",$1.s,$2.s);}
+	|T_IF T_ID T_GOTO T_ID {fprintf(cc->opt,"%s %s %s %s\n",$1.s,$2.s,$3.s,$4.s);}
+	|T_ID':' {fprintf(cc->opt,"%s:\n",$1.s);}
+	|T_START {fprintf(cc->opt,"%s\n",$1.s);}
+	|T_STOP   {fprintf(cc->opt,"%s\n",$1.s);}
+	|T_ID '=' T_ID '[' T_ID ']' {fprintf(cc->opt,"%s %s %s%s%s%s\n",$1.s,$2.s,$3.s,$4.s,$5.s,$6.s);}
+	|T_ID '[' T_ID ']' '=' T_ID {fprintf(cc->opt,"%s%s%s%s %s %s",$1.s,$2.s,$3.s,$4.s,$5.s,$6.s);}
 	;
 
 opr
@@ -93,104 +87,146 @@ opr
 
 int main()
 {
-opt = fopen("Optimised.txt", "w");
-if(opt==NULL)
+COMPILATION cc;
+memset(&cc, 0, sizeof(cc));
+initLexer(&cc.lex);
+cc.opt = fopen("Optimised.txt", "w");
+if(cc.opt==NULL)
 {
 	printf("ICG not found\n");
 }
-yyin = fopen("icg.txt","r");
-if(!yyparse())
+if(openSource(&cc.lex, "icg.txt") != 0)
+{
+	printf("ICG not found\n");
+	return 1;
+}
+if(!yyparse(&cc.lex, &cc))
 {
 	printf("Optimised ICG Generated\n");
 }
+closeSource(&cc.lex);
+free(cc.table);
+freeLexer(&cc.lex);
 
 return 1;
 }
 
-void yyerror(const char *msg)
+void yyerror(LEXER *lx, COMPILATION *cc, const char *msg)
 {
 
 	printf("\n");
 	printf("ERROR\n");
 	printf("Parsing Unsuccesful\n");
-	printf("Error at line %d\n\n",line);
+	printf("Error at line %u\n\n",offsetLine(&lx->lines,lx->tokpos,NULL));
 
 }
 
-void add_or_update(char* name,char* value)
+/* records the value of name id; NULL means it is no longer a known constant */
+void add_or_update(COMPILATION *cc,int id,NUMVAL* value)
 {
-	if(top==-1)
-	{
-
-		top++;
-		strcpy(table[top].name,name);
-		strcpy(table[top].value,value);
-		return;
-	}
-	for(int i = top;i>=0;i--)
+	int n;
+	if(id >= cc->tablecap)
 	{
-		if(strcmp(table[i].name,name)==0)
-		{
-			strcpy(table[i].value,value);
+		if(value == NULL)
 			return;
-		}
+		n = cc->tablecap ? cc->tablecap : 256;
+		while(n <= id)
+			n *= 2;
+		cc->table = (NODE*)realloc(cc->table,n*sizeof(NODE));
+		memset(cc->table+cc->tablecap,0,(n-cc->tablecap)*sizeof(NODE));
+		cc->tablecap = n;
 	}
+	cc->table[id].known = value != NULL;
+	if(value != NULL)
+		cc->table[id].value = *value;
+}
+NUMVAL* getVal(COMPILATION *cc,int id)
+{
+	if(id < cc->tablecap && cc->table[id].known)
+		return &cc->table[id].value;
+	return NULL;
+}
 
-	top++;
-
-	strcpy(table[top].name,name);
-
-	strcpy(table[top].value,value);
-
-
-
+static int truth(NUMVAL* v)
+{
+	return v->kind == NUM_INT ? v->i != 0 : v->d != 0;
 }
-char* getVal(char* name)
+
+/*
+	res = op1 opr op2 on the decoded values. Integers use 64-bit arithmetic
+	and reals use double; returns -1 when the expression must stay as it is
+	(overflow, division by zero, % on reals).
+*/
+int calculate(char* opr,NUMVAL* op1,NUMVAL* op2,NUMVAL* res)
 {
-	for(int i = top;i>=0;i--)
+	int real = op1->kind == NUM_REAL || op2->kind == NUM_REAL;
+	double a = op1->d, b = op2->d;
+	long long x = op1->i, y = op2->i;
+	int ov = 0;
+	res->kind = NUM_INT;
+	res->overflow = 0;
+	if(strcmp(opr,"&&")==0)
+		res->i = truth(op1) && truth(op2);
+	else if(strcmp(opr,"||")==0)
+		res->i = truth(op1) || truth(op2);
+	else if(strcmp(opr,">")==0)
+		res->i = real ? a > b : x > y;
+	else if(strcmp(opr,"<")==0)
+		res->i = real ? a < b : x < y;
+	else if(strcmp(opr,">=")==0)
+		res->i = real ? a >= b : x >= y;
+	else if(strcmp(opr,"<=")==0)
+		res->i = real ? a <= b : x <= y;
+	else if(strcmp(opr,"==")==0)
+		res->i = real ? a == b : x == y;
+	else if(strcmp(opr,"!=")==0)
+		res->i = real ? a != b : x != y;
+	else if(real)
 	{
-		if(strcmp(table[i].name,name)==0)
-		{
-			return table[i].value;
-		}
+		res->kind = NUM_REAL;
+		if(strcmp(opr,"+")==0)
+			res->d = a + b;
+		else if(strcmp(opr,"-")==0)
+			res->d = a - b;
+		else if(strcmp(opr,"*")==0)
+			res->d = a * b;
+		else if(strcmp(opr,"/")==0 && b != 0)
+			res->d = a / b;
+		else
+			return -1;
+		if(res->d - res->d != 0)
+			return -1;
+		res->i = res->d < 9.2e18 && res->d > -9.2e18 ? (long long)res->d : 0;
+		return 0;
 	}
-	return "a";
+	else if(strcmp(opr,"+")==0)
+		ov = __builtin_add_overflow(x, y, &res->i);
+	else if(strcmp(opr,"-")==0)
+		ov = __builtin_sub_overflow(x, y, &res->i);
+	else if(strcmp(opr,"*")==0)
+		ov = __builtin_mul_overflow(x, y, &res->i);
+	else if((strcmp(opr,"/")==0 || strcmp(opr,"%")==0) && y != 0 && !(y == -1 && x == LLONG_MIN))
+		res->i = opr[0] == '/' ? x / y : x % y;
+	else
+		return -1;
+	res->d = (double)res->i;
+	return ov ? -1 : 0;
 }
-char* calculate(char* opr,char* op1,char* op2)
-{
-	char* result;
-	result = (char*)malloc(sizeof(char)*30);
-	int oper1 = atoi(op1);
-	int oper2 = atoi(op2);
-	int res;
-	if(strcmp(opr,"+")==0)
-		res = oper1 + oper2;
-	if(strcmp(opr,"-")==0)
-		res = oper1 - oper2;
-	if(strcmp(opr,"*")==0)
-		res = oper1 * oper2;
-	if(strcmp(opr,"/")==0)
-		res = oper1 / oper2;
-	if(strcmp(opr,">")==0)
-		res = oper1 > oper2;
-	if(strcmp(opr,"<")==0)
-		res = oper1 < oper2;
-	if(strcmp(opr,">=")==0)
-		res = oper1 >= oper2;
-	if(strcmp(opr,"<=")==0)
-		res = oper1 <= oper2;
-	if(strcmp(opr,"mod")==0)
-		res = oper1 % oper2;
-	if(strcmp(opr,"==")==0)
-		res = oper1 == oper2;
-	if(strcmp(opr,"!=")==0)
-		res = oper1 != oper2;
-	if(strcmp(opr,"&&")==0)
-		res = oper1 && oper2;
-	if(strcmp(opr,"||")==0)
-		res = oper1 || oper2;
 
-
-	snprintf(result,30*sizeof(char),"%d",res);
-	return result;
+/* dst = a opr b: folds it when both operands are known, else copies it through */
+void fold(COMPILATION *cc,TACVAL* dst,TACVAL* a,char* opr,TACVAL* b)
+{
+	NUMVAL *x = a->s[0] >= '0' && a->s[0] <= '9' ? &a->num : getVal(cc,a->id);
+	NUMVAL *y = b->s[0] >= '0' && b->s[0] <= '9' ? &b->num : getVal(cc,b->id);
+	NUMVAL res;
+	if(x != NULL && y != NULL && calculate(opr,x,y,&res) == 0)
+	{
+		add_or_update(cc,dst->id,&res);
+		fprintf(cc->opt,"%s = ",dst->s);
+		printNumber(cc->opt,&res);
+		fputc('\n',cc->opt);
+		return;
+	}
+	add_or_update(cc,dst->id,NULL);
+	fprintf(cc->opt,"%s = %s %s %s\n",dst->s,a->s,opr,b->s);
 }
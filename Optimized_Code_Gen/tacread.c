@@ -0,0 +1,178 @@
+/*
+	Hand-written reader for icg.txt, a drop-in replacement for the flex
+	scanner generated from optimicons.l. Build it instead of lex.yy.c:
+		yacc -d optimicons.y
+		gcc -I. tacread.c y.tab.c
+
+	The file is mapped with srcmap.c and scanned in place. Names and
+	numbers are interned, so a token's s is the same pointer for every use
+	of a name and its id indexes the optimizer's constant table directly.
+	Operators and keywords point at constant strings. Nothing is allocated
+	per token; memory grows only with the number of distinct names.
+*/
+#include "header.c"
+#define YYSTYPE TACVAL
+#include "y.tab.h"
+#include <stdio.h>
+#include "../Lexer/intern.c"
+#include "../Lexer/srcmap.c"
+#include "../Lexer/linetab.c"
+#include "../Lexer/numlit.c"
+#include "../Lexer/utf8id.c"
+#include "../Lexer/lexer.c"
+
+/* operators: one character, or the second character completing a two-character one */
+typedef struct tacop
+{
+	char c;
+	char next;
+	int one;			/* token for the single character, 0 if it is skipped */
+	int two;
+	char *text1;
+	char *text2;
+}TACOP;
+
+static const TACOP tacops[] = {
+	{'|', '|', 0, T_OR_OP, NULL, "||"},
+	{'&', '&', 0, T_AND_OP, NULL, "&&"},
+	{'=', '=', '=', T_EQ_OP, "=", "=="},
+	{'!', '=', 0, T_NE_OP, NULL, "!="},
+	{'<', '=', '<', T_LE_OP, "<", "<="},
+	{'>', '=', '>', T_GE_OP, ">", ">="},
+	{'%', 0, T_MOD_OP, 0, "%", NULL},
+	{':', 0, ':', 0, ":", NULL},
+	{'-', 0, '-', 0, "-", NULL},
+	{'+', 0, '+', 0, "+", NULL},
+	{'*', 0, '*', 0, "*", NULL},
+	{'/', 0, '/', 0, "/", NULL},
+	{'[', 0, '[', 0, "[", NULL},
+	{']', 0, ']', 0, "]", NULL},
+};
+
+static int isDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+static int word(char *s, int n, const char *w)
+{
+	return n == (int)strlen(w) && memcmp(s, w, n) == 0;
+}
+
+/* the next token of lx into *lval; all of the reader's state is in lx */
+int yylex(YYSTYPE *lval, LEXER *lx)
+{
+	char *s, *p;
+	int i, n;
+	for(;;)
+	{
+		p = lx->p;
+		while(p < lx->end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' || *p == '\v' || *p == '\f'))
+			p++;
+		if(p >= lx->end)
+		{
+			lx->p = p;
+			return 0;
+		}
+		s = p;
+		lx->tokpos = s - lx->buf;
+		lval->id = 0;
+		if(isDigit(*p))
+		{
+			while(p < lx->end && isDigit(*p))
+				p++;
+			if(p + 1 < lx->end && *p == '.' && isDigit(p[1]))
+				for(p++;p < lx->end && isDigit(*p);p++)
+					;
+			lx->p = p;
+			lval->id = intern(&lx->names, s, p - s);
+			lval->s = internStr(&lx->names, lval->id);
+			lexNumber(lx, &lval->num, lval->id, lx->tokpos);
+			return T_NUMBER;
+		}
+		if(lx->end - p >= 5 && memcmp(p, "go to", 5) == 0)
+		{
+			lx->p = p + 5;
+			lval->s = "go to";
+			return T_GOTO;
+		}
+		n = identLength(p, lx->end - p);
+		if(n > 0)
+		{
+			lx->p = p + n;
+			if(word(s, n, "if"))
+			{
+				lval->s = "if";
+				return T_IF;
+			}
+			if(word(s, n, "start"))
+			{
+				lval->s = "start";
+				return T_START;
+			}
+			if(word(s, n, "stop"))
+			{
+				lval->s = "stop";
+				return T_STOP;
+			}
+			lval->id = intern(&lx->names, s, n);
+			lval->s = internStr(&lx->names, lval->id);
+			return T_ID;
+		}
+		lx->p = p + 1;
+		for(i=0;i<(int)(sizeof(tacops)/sizeof(tacops[0]));i++)
+			if(tacops[i].c == *p)
+			{
+				if(tacops[i].next && p + 1 < lx->end && p[1] == tacops[i].next)
+				{
+					lx->p = p + 2;
+					lval->s = tacops[i].text2;
+					return tacops[i].two;
+				}
+				if(tacops[i].one)
+				{
+					lval->s = tacops[i].text1;
+					return tacops[i].one;
+				}
+				break;
+			}
+		/* anything else is skipped, as optimicons.l does */
+	}
+}
+
+/* maps path, or reads it whole when it cannot be mapped */
+int openSource(LEXER *lx, char *path)
+{
+	size_t len, cap, n;
+	FILE *f;
+	lx->buf = mapSource(&lx->src, path, &len);
+	if(lx->buf == NULL)
+	{
+		f = fopen(path, "r");
+		if(f == NULL)
+			return -1;
+		cap = 1<<16;
+		len = 0;
+		lx->readbuf = (char*)malloc(cap);
+		while((n = fread(lx->readbuf + len, 1, cap - len, f)) > 0)
+		{
+			len += n;
+			if(len == cap)
+				lx->readbuf = (char*)realloc(lx->readbuf, cap *= 2);
+		}
+		fclose(f);
+		lx->buf = lx->readbuf;
+	}
+	lx->p = lx->buf;
+	lx->end = lx->buf + len;
+	lineTableSource(&lx->lines, lx->buf, len);
+	return 0;
+}
+
+void closeSource(LEXER *lx)
+{
+	unmapSource(&lx->src);
+	free(lx->readbuf);
+	lx->readbuf = NULL;
+	lx->buf = lx->p = lx->end = NULL;
+}
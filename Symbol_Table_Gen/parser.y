@@ -2,6 +2,7 @@
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
+#include "../Lexer/lexer.h"
 struct double_list{
   struct double_list * next;
   char name[30];
@@ -15,7 +16,10 @@ struct double_list{
   }value;
 };
 int type=0;
-extern int lineno;
+/* this phase reads one file per run, so its lexer is a single global */
+LEXER lex;
+void initLexer(LEXER *lx);
+unsigned offsetLine(LINETAB *lt, unsigned off, unsigned *col);
 extern int scope;
 typedef struct double_list d_list;
 d_list* head=NULL;
@@ -26,6 +30,9 @@ int fill(char*name,int value,int type);
 int lookupsymb(char *id);
 void display();
 int update(char* id,int value);
+int openSource(char *path);
+int openReplay(LEXER *lx, char *tokpath, char *srcpath);
+void releaseText(LEXER *lx);
 
 %}
 %union
@@ -50,8 +57,14 @@ int update(char* id,int value);
 %token	T_ADD T_SUB	T_MUL T_DIV T_MOD T_UADD T_USUB
 %token T_OB T_CB
 %type<number> UNREXPR INDEX
-%type<number> ADDEXPR MULTEXPR RELEXPR LOGICALANDEXPR LOGICALOREXPR EQUALITYEXPR
+%type<number> LOGICALOREXPR
 %type<number> ASSGN EXPR 
+%left T_LOGOR
+%left T_LOGAND
+%left T_EQ T_NEQ
+%left T_LT T_GT T_LTEQ T_GTEQ
+%left T_ADD T_SUB
+%left T_MUL T_DIV T_MOD
 %%
 START:	MODIFIER T_CLASS T_ID T_OB
         MODIFIER TYPE T_MAIN'('T_STRING'['']' T_ID')' T_OB
@@ -66,11 +79,14 @@ W1:		T_PUBLIC
 W2:		T_STATIC
 		|;
 
-S:		DECLR';'S
-		|ASSGN1';'S
-		|IF ELSE S
-		|FOR T_OB S T_CB S
-		|UNREXPR
+/* left-recursive, so the parser stack grows with nesting and not with the number of statements */
+S:		STMTS
+		|STMTS UNREXPR;
+
+STMTS:	STMTS DECLR';'
+		|STMTS ASSGN1';'
+		|STMTS IF ELSE
+		|STMTS FOR T_OB S T_CB
 		|;
 
 UNREXPR: T_UADD EXPR {$$=$2;}
@@ -79,22 +95,25 @@ UNREXPR: T_UADD EXPR {$$=$2;}
 		|EXPR T_USUB
 		|LOGICALOREXPR;
 
-FOR:	T_FOR'('';'';'')'
+FORHEAD:	T_FOR'('';'';'')'
 		|T_FOR'('INIT';'';'')'
 		|T_FOR'('INIT';'LOGICALOREXPR';'')'
-		|T_FOR'('INIT';'';'ADDEXPR')'
+		|T_FOR'('INIT';'';'UNREXPR')'
 		|T_FOR'('';'LOGICALOREXPR';'')'
 		|T_FOR'('';'LOGICALOREXPR';'UNREXPR')'
 		|T_FOR'('INIT';'LOGICALOREXPR';'UNREXPR')'
-		|T_FOR'('';'';'ADDEXPR')';
+		|T_FOR'('';'';'UNREXPR')';
+
+FOR:	FORHEAD	{releaseText(&lex);};
 
-IF:T_IF'('LOGICALOREXPR')' T_OB S T_CB;
+IF:T_IF'('LOGICALOREXPR')' T_OB S T_CB	{releaseText(&lex);};
 
-ELSE:	T_ELSE T_OB S T_CB
+ELSE:	T_ELSE T_OB S T_CB	{releaseText(&lex);}
 		|;
 
-DECLR:	VARIABLE
-		|ARRAY;
+/* each finished statement frees the identifier text the lexer lent it */
+DECLR:	VARIABLE	{releaseText(&lex);}
+		|ARRAY	{releaseText(&lex);};
 //DECLR:	TYPE LIST;
 
 VARIABLE:	TYPE T_ID T_ASSGN LOGICALOREXPR X	{fill($2,$4,type);}
@@ -157,8 +176,8 @@ ASSGN:  T_ID ASSGNOPR LOGICALOREXPR	{//if(type==0)
 									 //else
 										/*fillchar($1,(char)$3,type);*/};
 
-ASSGN1:	VARIABLEA
-		|ARRAYA;
+ASSGN1:	VARIABLEA	{releaseText(&lex);}
+		|ARRAYA	{releaseText(&lex);};
 
 VARIABLEA:T_ID ASSGNOPR LOGICALOREXPR	{update($1,$3);};
 
@@ -179,29 +198,20 @@ ASSGNOPR: T_ASSGN
 		| T_XORASSGN
 		| T_ORASSGN;
 
-LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALANDEXPR {$$=$1 || $3;}
-		|LOGICALANDEXPR;
-
-LOGICALANDEXPR: LOGICALANDEXPR T_LOGAND EQUALITYEXPR {$$=$1 && $3;}
-		|EQUALITYEXPR;
-
-EQUALITYEXPR: EQUALITYEXPR T_EQ RELEXPR {$$=$1==$3;}
-		| EQUALITYEXPR T_NEQ RELEXPR {$$=$1!=$3;}
-		|RELEXPR;
-
-RELEXPR:  RELEXPR T_LT ADDEXPR {$$=$1<$3;} 
-		| RELEXPR T_GT ADDEXPR {$$=$1>$3;}
-		| RELEXPR T_LTEQ ADDEXPR {$$=$1<=$3;}
-		| RELEXPR T_GTEQ ADDEXPR {$$=$1>=$3;}
-		|ADDEXPR;
-
-ADDEXPR:  ADDEXPR T_ADD MULTEXPR {$$=$1+$3;}
-		| ADDEXPR T_SUB MULTEXPR {$$=$1-$3;}
-		|MULTEXPR;
-
-MULTEXPR: MULTEXPR T_MUL EXPR {$$=$1*$3;}
-		| MULTEXPR T_DIV EXPR {$$=$1/$3;}
-		| MULTEXPR T_MOD EXPR {$$=$1%$3;}
+/* one rule per binary operator, ranked by the %left lines above */
+LOGICALOREXPR:LOGICALOREXPR T_LOGOR LOGICALOREXPR {$$=$1 || $3;}
+		| LOGICALOREXPR T_LOGAND LOGICALOREXPR {$$=$1 && $3;}
+		| LOGICALOREXPR T_EQ LOGICALOREXPR {$$=$1==$3;}
+		| LOGICALOREXPR T_NEQ LOGICALOREXPR {$$=$1!=$3;}
+		| LOGICALOREXPR T_LT LOGICALOREXPR {$$=$1<$3;}
+		| LOGICALOREXPR T_GT LOGICALOREXPR {$$=$1>$3;}
+		| LOGICALOREXPR T_LTEQ LOGICALOREXPR {$$=$1<=$3;}
+		| LOGICALOREXPR T_GTEQ LOGICALOREXPR {$$=$1>=$3;}
+		| LOGICALOREXPR T_ADD LOGICALOREXPR {$$=$1+$3;}
+		| LOGICALOREXPR T_SUB LOGICALOREXPR {$$=$1-$3;}
+		| LOGICALOREXPR T_MUL LOGICALOREXPR {$$=$1*$3;}
+		| LOGICALOREXPR T_DIV LOGICALOREXPR {$$=$1/$3;}
+		| LOGICALOREXPR T_MOD LOGICALOREXPR {$$=$1%$3;}
 		| EXPR;
 
 EXPR:	T_ID {$$=lookupsymb($1);}
@@ -320,13 +330,26 @@ int lookupsymb(char *id){
 }
 
 void yyerror(char *s) {
-fprintf(stderr, "%s at line number %d\n",s,lineno);
+fprintf(stderr, "%s at line number %u\n",s,offsetLine(&lex.lines,lex.tokpos,NULL));
 //fprintf(stderr, "%s at\n",s);
 //exit(0);
 }
-int main()
+int main(int argc, char *argv[])
 {
-	//yyin = fopen("something.txt", "r");
+	initLexer(&lex);
+	if(argc > 2 && strncmp(argv[2],"--replay=",9)==0)
+	{
+		if(openReplay(&lex, argv[2]+9, argv[1]) != 0)
+		{
+			fprintf(stderr, "cannot replay %s\n", argv[2]+9);
+			return 1;
+		}
+	}
+	else if(openSource(argc > 1 ? argv[1] : NULL) != 0)
+	{
+		fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
 	yyparse();
 	//fclose(yyin);
 	return 0;